@@ -37,8 +37,12 @@ FuxContext::~FuxContext() {
 void FuxContext::run() {
     debugPrint("Generating.");
     generate();
+    if (fuxCancel.cancelled())
+        return;
     debugPrint("Optimizing.");
     optimize();
+    if (fuxCancel.cancelled())
+        return;
     debugPrint("Compiling.");
     compile();
 }
@@ -23,13 +23,13 @@ Value *NoOperationAST::codegen(LLVMWrapper *fuxLLVM) { return nullptr; }
 
 Value *NullExprAST::codegen(LLVMWrapper *fuxLLVM) { return nullptr; }
 
-Value *BoolExprAST::codegen(LLVMWrapper *fuxLLVM) { return value->getLLVMValue(fuxLLVM); }
+Value *BoolExprAST::codegen(LLVMWrapper *fuxLLVM) { return value.getLLVMValue(fuxLLVM); }
 
-Value *NumberExprAST::codegen(LLVMWrapper *fuxLLVM) { return value->getLLVMValue(fuxLLVM); }
+Value *NumberExprAST::codegen(LLVMWrapper *fuxLLVM) { return value.getLLVMValue(fuxLLVM); }
 
-Value *CharExprAST::codegen(LLVMWrapper *fuxLLVM) { return value->getLLVMValue(fuxLLVM); }
+Value *CharExprAST::codegen(LLVMWrapper *fuxLLVM) { return value.getLLVMValue(fuxLLVM); }
 
-Value *StringExprAST::codegen(LLVMWrapper *fuxLLVM) { return value->getLLVMValue(fuxLLVM); }
+Value *StringExprAST::codegen(LLVMWrapper *fuxLLVM) { return value.getLLVMValue(fuxLLVM, literals); }
 
 Value *ArrayExprAST::codegen(LLVMWrapper *fuxLLVM) { return nullptr; }
 
@@ -109,7 +109,7 @@ Value *TernaryExprAST::codegen(LLVMWrapper *fuxLLVM) { return nullptr; }
 
 Value *VariableDeclAST::codegen(LLVMWrapper *fuxLLVM) {
     Type *llvmType = Generator::getType(fuxLLVM, type);
-    Value *that = fuxLLVM->builder->CreateAlloca(llvmType, 0, symbol);
+    Value *that = fuxLLVM->builder->CreateAlloca(llvmType, 0, string(fuxSymbols[symbol]));
     if (value) 
         fuxLLVM->builder->CreateStore(value->codegen(fuxLLVM), that);
     fuxLLVM->values[symbol] = FuxValue(llvmType, that);
@@ -153,12 +153,13 @@ Function *PrototypeAST::codegen(LLVMWrapper *fuxLLVM) {
     for (StmtAST::Ptr &param : args) 
         paramTypes.push_back(Generator::getType(fuxLLVM, param->getFuxType()));
     FunctionType *funcType = FunctionType::get(Generator::getType(fuxLLVM, type), paramTypes, false);
-    Function *func = Function::Create(funcType, Function::ExternalLinkage, symbol == "main" ? "main" : "Usr_"+symbol, *fuxLLVM->module);
+    Function *func = Function::Create(funcType, Function::ExternalLinkage, 
+        fuxSymbols[symbol] == "main" ? "main" : "Usr_"+string(fuxSymbols[symbol]), *fuxLLVM->module);
     return func;
 }
 
 Function *FunctionAST::codegen(LLVMWrapper *fuxLLVM) {
-    Function *func = fuxLLVM->module->getFunction(proto->getSymbol());  
+    Function *func = fuxLLVM->module->getFunction(string(fuxSymbols[proto->getSymbol()]));  
     if (!func)  func = proto->codegen(fuxLLVM);
     if (!func)  return nullptr; 
     
@@ -170,9 +171,9 @@ Function *FunctionAST::codegen(LLVMWrapper *fuxLLVM) {
 
     fuxLLVM->values.clear();
     for (auto &arg : func->args())
-        fuxLLVM->values[arg.getName().str()] = FuxValue(arg.getType(), &arg);
+        fuxLLVM->values[fuxSymbols.intern(arg.getName().str())] = FuxValue(arg.getType(), &arg);
 
-    Value *retVal = body->codegen(fuxLLVM);
+    Value *retVal = getBody()->codegen(fuxLLVM);
 
     if (!retVal) { // error reading body
         func->eraseFromParent();
@@ -187,8 +188,11 @@ Function *FunctionAST::codegen(LLVMWrapper *fuxLLVM) {
 }
 
 Value *RootAST::codegen(LLVMWrapper *fuxLLVM) {
-    for (StmtAST::Ptr &sub : program)
+    for (StmtAST::Ptr &sub : program) {
+        if (fuxCancel.cancelled())
+            break;
         sub->codegen(fuxLLVM);
+    }
     return nullptr;
 }
 
@@ -14,10 +14,15 @@
 #ifdef FUX_BACKEND
 
 Type *Generator::getType(LLVMWrapper *fuxLLVM, FuxType type) {
+    // a type is only an id, so the llvm type is created once per id
+    TypeList &types = fuxLLVM->types;
+    if (type.id() < types.size() && types[type.id()])
+        return types[type.id()];
+
     IRBuilder<> *builder = fuxLLVM->builder;
     Type* ret;
 
-    switch (type.kind) {
+    switch (type->kind) {
         case FuxType::VOID:     ret = builder->getVoidTy(); break;
         case FuxType::BOOL:     ret = builder->getInt1Ty(); break;
         case FuxType::I8:       ret = builder->getInt8Ty(); break;
@@ -36,11 +41,13 @@ Type *Generator::getType(LLVMWrapper *fuxLLVM, FuxType type) {
         default:                ret = nullptr;
     }
 
-    size_t pd = type.array ? type.pointerDepth + 1 : type.pointerDepth;
+    size_t pd = type->array ? type->pointerDepth + 1 : type->pointerDepth;
     while (pd --> 0) 
         ret = ret->getPointerTo();
 
-    return ret;
+    if (types.size() <= type.id())
+        types.resize(type.id() + 1, nullptr);
+    return types[type.id()] = ret;
 }
 
 #endif
\ No newline at end of file
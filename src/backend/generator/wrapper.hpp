@@ -11,12 +11,15 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "../llvmheader.hpp"
+#include "../../util/symbols.hpp"
 
 #ifdef FUX_BACKEND
 
 struct FuxValue {
-    typedef map<string, FuxValue> Map;
+    typedef std::unordered_map<SymbolId, FuxValue> Map;
 
     FuxValue(Type *type = nullptr, Value *value = nullptr) 
     : type(type), value(value), literal(false) {}
@@ -43,6 +46,7 @@ struct LLVMWrapper {
     IRBuilder<> *builder;
 
     FuxValue::Map values;
+    TypeList types; // Generator::getType() by TypeId
     Function *posix_puts = nullptr; // temporary, will be replaced
 };
 
@@ -0,0 +1,146 @@
+/**
+ * @file ast.cpp
+ * @author fuechs
+ * @brief fux pass benchmark: pointer tree vs. flat ast, parsing vs. ast cache
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "../frontend/parser/parser.hpp"
+#include "../frontend/ast/cache.hpp"
+#include "../frontend/ast/flat.hpp"
+#include "bench.hpp"
+
+FuxStruct fux;
+
+FuxOptions::~FuxOptions() {}
+
+// swallows debugPrint output
+struct NullBuffer : std::streambuf {
+    int overflow(int c) override { return c; }
+};
+
+template<typename Pass>
+Sample measure(Pass pass) {
+    auto start = std::chrono::steady_clock::now();
+    pass();
+    auto end = std::chrono::steady_clock::now();
+    return {std::chrono::duration<double>(end - start).count(), 0, 0};
+}
+
+int main(int argc, char **argv) {
+    size_t size = 4 * 1024 * 1024;
+    size_t warmup = 1;
+    size_t repetitions = 5;
+
+    for (int i = 1; i < argc; i++) {
+        const string arg = argv[i];
+        if (arg == "-size" && i + 1 < argc)             size = std::stoull(argv[++i]) * 1024 * 1024;
+        else if (arg == "-warmup" && i + 1 < argc)      warmup = std::stoull(argv[++i]);
+        else if (arg == "-repeat" && i + 1 < argc)      repetitions = std::max<size_t>(1, std::stoull(argv[++i]));
+        else {
+            cerr << "usage: " << argv[0] << " [-size <MB>] [-warmup <n>] [-repeat <n>]\n";
+            return 1;
+        }
+    }
+
+    const string fileName = "bench.fux";
+    const string cachePath = ASTCache::path(fileName);
+    const vector<Corpus> corpora = generateCorpora(size);
+    NullBuffer null;
+
+    cout << "{\n"
+         << "    \"benchmark\": \"ast\",\n"
+         << "    \"size_bytes\": " << size << ",\n"
+         << "    \"warmup\": " << warmup << ",\n"
+         << "    \"repetitions\": " << repetitions << ",\n"
+         << "    \"corpora\": [\n";
+
+    for (size_t c = 0; c < corpora.size(); c++) {
+        const Corpus &corpus = corpora[c];
+        SourceBuffer *buffer = SourceBuffer::fromString(corpus.source);
+        ErrorManager error = ErrorManager(true);
+        Arena arena;
+        Arena::Scope scope(&arena);
+
+        fux.options.debugMode = false;
+        Parser parser = Parser(&error, fileName, buffer);
+        RootAST::Ptr root = parser.parse();
+        const size_t treeBytes = arena.size();
+        fux.options.debugMode = true;
+
+        FlatAST flat;
+        const vector<Sample> flatten = repeat(warmup, repetitions, [&] {
+            return measure([&] { flat = FlatAST(*root); });
+        });
+        const size_t nodes = flat.size();
+
+        fux.options.debugMode = false;
+        const vector<Sample> parse = repeat(warmup, repetitions, [&] {
+            ErrorManager parseError = ErrorManager(true);
+            Arena parseArena;
+            Arena::Scope parseScope(&parseArena);
+            return measure([&] { Parser(&parseError, fileName, buffer).parse(); });
+        });
+        fux.options.debugMode = true;
+        const vector<Sample> cacheWrite = repeat(warmup, repetitions, [&] {
+            return measure([&] { ASTCache::write(cachePath, flat, *buffer, fileName); });
+        });
+        bool cached = true;
+        const vector<Sample> cacheRead = repeat(warmup, repetitions, [&] {
+            FlatAST loaded;
+            return measure([&] { cached = ASTCache::read(cachePath, *buffer, loaded) && cached; });
+        });
+        std::remove(cachePath.c_str());
+
+        const vector<Sample> treeAnalyse = repeat(warmup, repetitions, [&] {
+            SymbolTable table;
+            return measure([&] { root->analyse(Expectation(&error, &table)); });
+        });
+        const vector<Sample> flatAnalyse = repeat(warmup, repetitions, [&] {
+            SymbolTable table;
+            return measure([&] { flat.analyse(Expectation(&error, &table)); });
+        });
+
+        std::streambuf *output = cout.rdbuf(&null);
+        const vector<Sample> treePrint = repeat(warmup, repetitions, [&] {
+            return measure([&] { root->debugPrint(); });
+        });
+        const vector<Sample> flatPrint = repeat(warmup, repetitions, [&] {
+            return measure([&] { flat.debugPrint(); });
+        });
+        cout.rdbuf(output);
+
+        cout << "        {\n"
+             << "            \"name\": \"" << corpus.name << "\",\n"
+             << "            \"bytes\": " << corpus.source.size() << ",\n"
+             << "            \"nodes\": " << nodes << ",\n"
+             << "            \"errors\": " << error.errors() << ",\n"
+             << "            \"tree_bytes\": " << treeBytes << ",\n"
+             << "            \"flat_bytes\": " << flat.bytes() << ",\n"
+             << "            \"flatten\": " << statistics(flatten, {{"nodes", nodes}}) << ",\n"
+             << "            \"cache\": {\n"
+             << "                \"valid\": " << (cached ? "true" : "false") << ",\n"
+             << "                \"parse\": " << statistics(parse, {{"bytes", corpus.source.size()}}) << ",\n"
+             << "                \"write\": " << statistics(cacheWrite, {{"bytes", corpus.source.size()}}) << ",\n"
+             << "                \"read\": " << statistics(cacheRead, {{"bytes", corpus.source.size()}}) << "\n"
+             << "            },\n"
+             << "            \"analyse\": {\n"
+             << "                \"tree\": " << statistics(treeAnalyse, {{"nodes", nodes}}) << ",\n"
+             << "                \"flat\": " << statistics(flatAnalyse, {{"nodes", nodes}}) << "\n"
+             << "            },\n"
+             << "            \"debug_print\": {\n"
+             << "                \"tree\": " << statistics(treePrint, {{"nodes", nodes}}) << ",\n"
+             << "                \"flat\": " << statistics(flatPrint, {{"nodes", nodes}}) << "\n"
+             << "            }\n"
+             << "        }" << (c + 1 < corpora.size() ? "," : "") << "\n";
+
+        delete buffer;
+    }
+
+    cout << "    ]\n}\n";
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+/**
+ * @file bench.hpp
+ * @author fuechs
+ * @brief shared benchmark helpers & synthetic fux sources
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <random>
+
+#include "../fux.hpp"
+
+// one timed run; tokens & nodes are optional
+struct Sample {
+    double seconds;
+    size_t tokens;
+    size_t nodes;
+};
+
+template<typename Measure>
+inline vector<Sample> repeat(size_t warmup, size_t repetitions, Measure measure) {
+    for (size_t i = 0; i < warmup; i++)
+        measure();
+    vector<Sample> samples;
+    for (size_t i = 0; i < repetitions; i++)
+        samples.push_back(measure());
+    std::sort(samples.begin(), samples.end(), [](const Sample &a, const Sample &b) { return a.seconds < b.seconds; });
+    return samples;
+}
+
+// {"min": ..., "median": ..., "<unit>_per_sec": ...} with the median
+inline string statistics(const vector<Sample> &samples, const vector<pair<string, size_t>> &units) {
+    const double median = samples[samples.size() / 2].seconds;
+    stringstream ss;
+    ss << "{\"min_seconds\": " << samples.front().seconds << ", \"median_seconds\": " << median;
+    for (const auto &[unit, amount] : units)
+        ss << ", \"" << unit << "_per_sec\": " << (size_t) (amount / median);
+    ss << "}";
+    return ss.str();
+}
+
+struct Corpus {
+    string name;
+    string source;
+};
+
+// synthetic source: functions filled with statements from generate()
+// until the corpus is at least size bytes
+template<typename Generate>
+inline string generateCorpus(size_t size, Generate generate) {
+    std::mt19937 rng(42);
+    stringstream ss;
+    for (size_t function = 0; (size_t) ss.tellp() < size; function++) {
+        ss << "// function " << function << "\n";
+        ss << "function" << function << "(a: i64, b: i64, values: i32[]): i64 {\n";
+        for (size_t i = 0; i < 16; i++)
+            ss << "    " << generate(rng) << "\n";
+        ss << "    return a;\n}\n\n";
+    }
+    return ss.str();
+}
+
+inline vector<Corpus> generateCorpora(size_t size) {
+    auto number = [](std::mt19937 &rng) { return to_string(rng() % 100000); };
+    auto name = [](std::mt19937 &rng) {
+        static const char *names[] = {"a", "b", "value", "count", "index", "someLongerName", "x1", "total_sum"};
+        return string(names[rng() % 8]);
+    };
+
+    auto declaration = [&](std::mt19937 &rng) {
+        static const char *types[] = {"i32", "i64", "u8", "f64", "str", "c8", "bool", "u64[]"};
+        return name(rng) + to_string(rng() % 100) + ": " + types[rng() % 8] + " = " + number(rng) + ";";
+    };
+    auto expression = [&](std::mt19937 &rng) {
+        static const char *ops[] = {" + ", " - ", " * ", " / ", " % ", " == ", " < ", " && ", " | ", " <| "};
+        string expr = name(rng);
+        for (size_t i = 0, terms = 2 + rng() % 6; i < terms; i++) {
+            expr += ops[rng() % 10];
+            switch (rng() % 4) {
+                case 0:     expr += "(" + name(rng) + ops[rng() % 10] + number(rng) + ")"; break;
+                case 1:     expr += name(rng) + "(" + number(rng) + ", " + name(rng) + ")"; break;
+                case 2:     expr += "values[" + number(rng) + "]"; break;
+                default:    expr += number(rng); break;
+            }
+        }
+        return name(rng) + " = " + expr + ";";
+    };
+    auto pipe = [&](std::mt19937 &rng) {
+        switch (rng() % 3) {
+            case 0:     return name(rng) + " << " + number(rng) + " << \"text\";";
+            case 1:     return "\"text\" >> " + name(rng) + "(" + number(rng) + ");";
+            default:    return number(rng) + " >> values[] << " + number(rng) + ";";
+        }
+    };
+    auto comment = [&](std::mt19937 &rng) {
+        if (rng() % 2)
+            return "/* " + name(rng) + " is updated here, see " + name(rng) + " */ " + name(rng) + " = " + number(rng) + ";";
+        return "// " + name(rng) + " and " + name(rng) + " are documented here \n    " + name(rng) + " += 1;";
+    };
+    // operands nested up to 32 parens deep
+    std::function<string(std::mt19937 &, size_t)> nest = [&](std::mt19937 &rng, size_t depth) {
+        static const char *ops[] = {" + ", " * ", " - ", " && ", " << ", " == ", " ^ ", " |> "};
+        if (depth == 0)
+            return rng() % 2 ? name(rng) : number(rng);
+        if (rng() % 2)
+            return "(" + nest(rng, depth - 1) + ops[rng() % 8] + number(rng) + ")";
+        return "(" + name(rng) + ops[rng() % 8] + nest(rng, depth - 1) + ")";
+    };
+    auto nested = [&](std::mt19937 &rng) { return name(rng) + " = " + nest(rng, rng() % 33) + ";"; };
+    // generated lookup tables: arrays of number, char and string literals
+    auto table = [&](std::mt19937 &rng) {
+        static const char *words[] = {"\"alpha\"", "\"beta\\n\"", "\"gamma delta\"", "'x'", "'\\t'", "true"};
+        string elements;
+        for (size_t i = 0, amount = 8 + rng() % 24; i < amount; i++)
+            elements += (rng() % 2 ? number(rng) : string(words[rng() % 6])) + ", ";
+        return name(rng) + " = {" + elements + "};";
+    };
+    auto control = [&](std::mt19937 &rng) {
+        switch (rng() % 4) {
+            case 0:     return "if (" + name(rng) + " < " + number(rng) + ") { " + expression(rng) + " } else " + expression(rng);
+            case 1:     return "while (" + name(rng) + " > 0) " + name(rng) + " -= " + number(rng) + ";";
+            case 2:     return "for (i: u64; i < " + number(rng) + "; i++) { " + expression(rng) + " " + pipe(rng) + " }";
+            default:    return "do { " + declaration(rng) + " } while (" + name(rng) + ");";
+        }
+    };
+
+    vector<Corpus> corpora = {
+        {"declarations", generateCorpus(size, declaration)},
+        {"expressions", generateCorpus(size, expression)},
+        {"pipes", generateCorpus(size, pipe)},
+        {"comments", generateCorpus(size, comment)},
+        {"control", generateCorpus(size, control)},
+        {"nested", generateCorpus(size, nested)},
+        {"tables", generateCorpus(size, table)},
+    };
+
+    corpora.push_back({"mixed", generateCorpus(size, [&](std::mt19937 &rng) {
+        switch (rng() % 4) {
+            case 0:     return declaration(rng);
+            case 1:     return expression(rng);
+            case 2:     return pipe(rng);
+            default:    return comment(rng);
+        }
+    })});
+    return corpora;
+}
\ No newline at end of file
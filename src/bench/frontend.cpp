@@ -0,0 +1,172 @@
+/**
+ * @file frontend.cpp
+ * @author fuechs
+ * @brief fux lexer & parser throughput benchmark
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include <pthread.h>
+
+#include "../frontend/parser/parser.hpp"
+#include "../frontend/ast/visitor.hpp"
+#include "bench.hpp"
+
+FuxStruct fux;
+
+FuxOptions::~FuxOptions() {}
+
+// nodes of a tree, without the bodies that were not parsed (yet)
+class NodeCounter : public ASTVisitor<NodeCounter> {
+public:
+    size_t nodes = 0;
+
+    void visitStmt(StmtAST &node) {
+        ++nodes;
+        visitChildren(node);
+    }
+
+    void visitFunction(FunctionAST &function) {
+        ++nodes;
+        visit(function.proto);
+        for (StmtAST::Ptr &local : function.locals)
+            visit(local);
+        visit(function.body);
+    }
+};
+
+Sample measureLexer(const SourceBuffer *buffer, const string &fileName) {
+    ErrorManager error = ErrorManager(true);
+    auto start = std::chrono::steady_clock::now();
+    Lexer lexer = Lexer(buffer, fileName, &error);
+    const size_t tokens = lexer.lex().size();
+    auto end = std::chrono::steady_clock::now();
+    return {std::chrono::duration<double>(end - start).count(), tokens, 0};
+}
+
+Sample measureParser(const SourceBuffer *buffer, const string &fileName, size_t &errors, bool lazy = false) {
+    ErrorManager error = ErrorManager(true);
+    auto start = std::chrono::steady_clock::now();
+    Arena arena;
+    Arena::Scope scope(&arena);
+    Parser parser = Parser(&error, fileName, buffer, false, lazy);
+    RootAST::Ptr root = parser.parse();
+    auto end = std::chrono::steady_clock::now();
+    errors = error.errors();
+    NodeCounter counter;
+    counter.visit(root.get());
+    return {std::chrono::duration<double>(end - start).count(), 0, counter.nodes};
+}
+
+// run on a thread with a painted stack and return the amount of stack that was touched
+size_t measureStack(std::function<void()> run) {
+    static constexpr size_t size = 256 * 1024 * 1024;
+    static constexpr char paint = (char) 0xA5;
+    char *stack = new char[size];
+    std::memset(stack, paint, size);
+
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    pthread_attr_setstack(&attributes, stack, size);
+    pthread_t thread;
+    pthread_create(&thread, &attributes, [](void *run) -> void * {
+        (*(std::function<void()> *) run)();
+        return nullptr;
+    }, &run);
+    pthread_join(thread, nullptr);
+    pthread_attr_destroy(&attributes);
+
+    size_t untouched = 0; // the stack grows down
+    while (untouched < size && stack[untouched] == paint)
+        untouched++;
+    delete [] stack;
+    return size - untouched;
+}
+
+// stack used to parse a statement with operands nested depth parens deep
+size_t measureNesting(size_t depth) {
+    const string source = "a = " + string(depth, '(') + "b" + string(depth, ')') + ";";
+    SourceBuffer *buffer = SourceBuffer::fromString(source);
+    size_t errors = 0;
+    const size_t stack = measureStack([&] { measureParser(buffer, "nesting.fux", errors); });
+    delete buffer;
+    return stack;
+}
+
+int main(int argc, char **argv) {
+    size_t size = 4 * 1024 * 1024;
+    size_t warmup = 1;
+    size_t repetitions = 5;
+
+    for (int i = 1; i < argc; i++) {
+        const string arg = argv[i];
+        if (arg == "-size" && i + 1 < argc)             size = std::stoull(argv[++i]) * 1024 * 1024;
+        else if (arg == "-warmup" && i + 1 < argc)      warmup = std::stoull(argv[++i]);
+        else if (arg == "-repeat" && i + 1 < argc)      repetitions = std::max<size_t>(1, std::stoull(argv[++i]));
+        else if (arg == "-nothread")                    fux.options.threading = false;
+        else if (arg == "-j" && i + 1 < argc)           fux.options.jobs = std::max<size_t>(1, std::stoull(argv[++i]));
+        else {
+            cerr << "usage: " << argv[0] << " [-size <MB>] [-warmup <n>] [-repeat <n>] [-nothread] [-j <n>]\n";
+            return 1;
+        }
+    }
+
+    fux.options.debugMode = false;
+    const string fileName = "bench.fux";
+    const vector<Corpus> corpora = generateCorpora(size);
+
+    cout << "{\n"
+         << "    \"benchmark\": \"frontend\",\n"
+         << "    \"size_bytes\": " << size << ",\n"
+         << "    \"warmup\": " << warmup << ",\n"
+         << "    \"repetitions\": " << repetitions << ",\n"
+         << "    \"threading\": " << (fux.options.threading ? "true" : "false") << ",\n"
+         << "    \"jobs\": " << fux.options.jobs << ",\n"
+         << "    \"corpora\": [\n";
+
+    for (size_t c = 0; c < corpora.size(); c++) {
+        const Corpus &corpus = corpora[c];
+        SourceBuffer *buffer = SourceBuffer::fromString(corpus.source);
+        const size_t bytes = corpus.source.size();
+        size_t errors = 0;
+
+        const vector<Sample> lexer = repeat(warmup, repetitions, [&] { return measureLexer(buffer, fileName); });
+        const vector<Sample> parser = repeat(warmup, repetitions, [&] { return measureParser(buffer, fileName, errors); });
+        // only the prototypes, like an imported package whose functions are not used
+        size_t lazyErrors = 0;
+        const vector<Sample> lazy = repeat(warmup, repetitions, [&] { return measureParser(buffer, fileName, lazyErrors, true); });
+        const size_t tokens = lexer.front().tokens;
+        const size_t nodes = parser.front().nodes;
+
+        cout << "        {\n"
+             << "            \"name\": \"" << corpus.name << "\",\n"
+             << "            \"bytes\": " << bytes << ",\n"
+             << "            \"tokens\": " << tokens << ",\n"
+             << "            \"nodes\": " << nodes << ",\n"
+             << "            \"errors\": " << errors << ",\n"
+             << "            \"lex\": " << statistics(lexer, {{"tokens", tokens}, {"bytes", bytes}}) << ",\n"
+             << "            \"parse\": " << statistics(parser, {{"tokens", tokens}, {"bytes", bytes}, {"nodes", nodes}}) << ",\n"
+             << "            \"parse_lazy\": " << statistics(lazy, {{"tokens", tokens}, {"bytes", bytes}, {"nodes", lazy.front().nodes}}) << "\n"
+             << "        }" << (c + 1 < corpora.size() ? "," : "") << "\n";
+
+        delete buffer;
+    }
+
+    cout << "    ],\n"
+         << "    \"stack\": [\n";
+
+    // the baseline (no nesting) is subtracted to get the bytes per paren
+    const size_t depths[] = {16, 256, 4096};
+    const size_t baseline = measureNesting(0);
+    for (size_t d = 0; d < 3; d++) {
+        const size_t stack = measureNesting(depths[d]);
+        cout << "        {\"depth\": " << depths[d] << ", \"bytes\": " << stack
+             << ", \"bytes_per_level\": " << (stack - baseline) / depths[d] << "}" << (d < 2 ? "," : "") << "\n";
+    }
+
+    cout << "    ]\n}\n";
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+/**
+ * @file keywords.cpp
+ * @author fuechs
+ * @brief fux keyword lookup benchmark
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include <chrono>
+#include <random>
+
+#include "../frontend/lexer/keywords.hpp"
+
+FuxStruct fux;
+
+FuxOptions::~FuxOptions() {}
+
+// previous implementation of Lexer::checkKeyword()
+TokenType linearLookup(string_view word) {
+    auto it = std::find(std::begin(TokenTypeValue), std::end(TokenTypeValue), word);
+    if (it != std::end(TokenTypeValue))
+        return (TokenType) (it - std::begin(TokenTypeValue));
+    return IDENTIFIER;
+}
+
+// identifier heavy input: 1/3 keywords, 2/3 identifiers
+vector<string> generateWords(size_t amount) {
+    static const char chars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+    std::mt19937 rng(42);
+    vector<string> words;
+    words.reserve(amount);
+
+    while (words.size() < amount) {
+        if (rng() % 3 == 0) {
+            words.push_back(TokenTypeValue[KEY_GET + rng() % (KEY_TEMPLATE - KEY_GET + 1)]);
+            continue;
+        }
+
+        string word(1, chars[rng() % 52]); // starts with a letter
+        for (size_t length = 1 + rng() % 12; word.size() < length;)
+            word.push_back(chars[rng() % (sizeof(chars) - 1)]);
+        words.push_back(word);
+    }
+
+    return words;
+}
+
+template<typename Lookup>
+double measure(const vector<string> &words, size_t repetitions, Lookup lookup, size_t &checksum) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < repetitions; i++)
+        for (const string &word : words)
+            checksum += lookup(word);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (words.size() * repetitions);
+}
+
+int main(int argc, char **argv) {
+    const size_t amount = argc > 1 ? std::stoull(argv[1]) : 1000000;
+    const size_t repetitions = argc > 2 ? std::stoull(argv[2]) : 10;
+    const vector<string> words = generateWords(amount);
+
+    for (const string &word : words) {
+        TokenType expected = linearLookup(word);
+        if (expected < KEY_GET || expected > KEY_TEMPLATE)
+            expected = IDENTIFIER; // linear search also matched "ident", "none", ...
+        if (fuxKeywords::lookup(word) != expected) {
+            cerr << "lookup mismatch for '" << word << "'\n";
+            return 1;
+        }
+    }
+
+    size_t linearSum = 0, hashSum = 0;
+    measure(words, 1, linearLookup, linearSum); // warmup
+    measure(words, 1, fuxKeywords::lookup, hashSum);
+    linearSum = hashSum = 0;
+
+    const double linear = measure(words, repetitions, linearLookup, linearSum);
+    const double hash = measure(words, repetitions, fuxKeywords::lookup, hashSum);
+
+    cout << "keyword lookup (" << amount << " words, " << repetitions << " repetitions)\n"
+         << "    linear search: " << linear << " ns/word\n"
+         << "    perfect hash:  " << hash << " ns/word\n"
+         << "    speedup:       " << linear / hash << "x\n"
+         << "    (checksums " << linearSum << ", " << hashSum << ")\n";
+    return 0;
+}
\ No newline at end of file
@@ -10,6 +10,7 @@
  */
 
 #include "analyser.hpp"
+#include "../ast/flat.hpp"
 
 StmtAST::Ptr Analyser::analyse() { return origin->analyse(Expectation(error, table)); }
 
@@ -77,14 +78,39 @@ StmtAST::Ptr PrototypeAST::analyse(Expectation exp) {
 
 StmtAST::Ptr FunctionAST::analyse(Expectation exp) {
     proto->analyse(exp);
-    body->analyse(exp);
-    return (StmtAST::Ptr) this;
+    if (getBody())
+        body->analyse(exp);
+    return nullptr;
 }
 
 StmtAST::Ptr RootAST::analyse(Expectation exp) {
     RootAST::Ptr mod = make_unique<RootAST>();
     StmtAST::Ptr modStmt = nullptr;
-    for (StmtAST::Ptr &stmt : program) 
+    for (StmtAST::Ptr &stmt : program) {
+        if (fuxCancel.cancelled())
+            break;
         mod->addSub((modStmt = stmt->analyse(exp)));  
+    }
     return mod;
+}
+
+// mirrors the analyse() functions above: only prototypes on the top level
+// (or of functions) are analysed yet, so this walks over the children of root
+void FlatAST::analyse(Expectation exp) {
+    if (nodes.empty())
+        return;
+
+    for (Index stmt = child(0); stmt < end(0) && !fuxCancel.cancelled(); stmt = next(stmt)) {
+        Index proto = stmt;
+        if (nodes[stmt].kind == AST::FunctionAST)
+            proto = child(stmt);
+        if (nodes[proto].kind != AST::PrototypeAST)
+            continue;
+
+        Symbol *that = new Symbol(Symbol::FUNC, FuxType::byId(nodes[proto].type));
+        for (Index arg = child(proto); arg < end(proto); arg = next(arg))
+            if (nodes[arg].kind == AST::VariableDeclAST)
+                that->parameters.push_back(FuxType::byId(nodes[arg].type));
+        exp.table->insert(nodes[proto].data, that);
+    }
 }
\ No newline at end of file
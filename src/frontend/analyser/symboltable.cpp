@@ -19,21 +19,21 @@ Symbol::Symbol(Kind kind, FuxType type, FuxType::Vec parameters)
 Symbol::Symbol(Symbol *parent, Kind kind, FuxType type, FuxType::Vec parameters)
 : kind(kind), type(type), parameters(parameters), member(true), parent(parent) {}
 
-Symbol *Symbol::operator[](string symbol) { return members.contains(symbol) ? members.at(symbol) : nullptr; }
+Symbol *Symbol::operator[](SymbolId symbol) { return members.contains(symbol) ? members.at(symbol) : nullptr; }
 
-Symbol *Symbol::addMember(string name, Kind kind, FuxType type, FuxType::Vec parameters) { 
+Symbol *Symbol::addMember(SymbolId name, Kind kind, FuxType type, FuxType::Vec parameters) { 
     Symbol *sym = new Symbol(this, kind, type, parameters);
     members[name] = sym;
     return sym;
 }
 
-Symbol *SymbolTable::operator[](string symbol) { return table.contains(symbol) ? table.at(symbol) : nullptr; }
+Symbol *SymbolTable::operator[](SymbolId symbol) { return table.contains(symbol) ? table.at(symbol) : nullptr; }
 
-Symbol *SymbolTable::contains(string symbol) { return operator[](symbol); }
+Symbol *SymbolTable::contains(SymbolId symbol) { return operator[](symbol); }
 
-void SymbolTable::insert(string symbol, Symbol *_symbol) { table[symbol] = _symbol; }
-void SymbolTable::insert(string symbol, Symbol::Kind kind, FuxType type) { table[symbol] = new Symbol(kind, type); }
-void SymbolTable::erase(string symbol) { table[symbol] = nullptr; /* leave the field for error reporting */ }
+void SymbolTable::insert(SymbolId symbol, Symbol *_symbol) { table[symbol] = _symbol; }
+void SymbolTable::insert(SymbolId symbol, Symbol::Kind kind, FuxType type) { table[symbol] = new Symbol(kind, type); }
+void SymbolTable::erase(SymbolId symbol) { table[symbol] = nullptr; /* leave the field for error reporting */ }
 
 auto SymbolTable::begin() { return table.begin(); }
 auto SymbolTable::end() { return table.end(); }
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "../parser/type.hpp"
+#include "../../util/symbols.hpp"
 
 struct Symbol {
 public:
@@ -29,14 +30,14 @@ public:
         NONE,       
     };
     
-    typedef std::unordered_map<std::string, Symbol *> Map;
+    typedef std::unordered_map<SymbolId, Symbol *> Map;
     
     Symbol(Kind kind = NONE, FuxType type = FuxType::NO_TYPE, FuxType::Vec parameters = FuxType::Vec());
     Symbol(Symbol *parent, Kind kind = NONE, FuxType type = FuxType::NO_TYPE, FuxType::Vec parameters = FuxType::Vec());
     
-    Symbol *operator[](std::string symbol);
+    Symbol *operator[](SymbolId symbol);
 
-    Symbol *addMember(std::string name, Kind kind = NONE, FuxType type = FuxType::NO_TYPE, FuxType::Vec parameters = FuxType::Vec());
+    Symbol *addMember(SymbolId name, Kind kind = NONE, FuxType type = FuxType::NO_TYPE, FuxType::Vec parameters = FuxType::Vec());
 
     Kind kind;
     FuxType type;
@@ -54,17 +55,17 @@ public:
     SymbolTable() : table(Symbol::Map()) {}
 
     // get Symbol * of name `symbol`
-    Symbol *operator[](std::string symbol);
+    Symbol *operator[](SymbolId symbol);
 
     // aka operator[]
-    Symbol *contains(std::string symbol);
+    Symbol *contains(SymbolId symbol);
     
     // insert given Symbol * `_symbol` at name `symbol`
-    void insert(std::string symbol, Symbol *_symbol);
+    void insert(SymbolId symbol, Symbol *_symbol);
     // create new Symbol * at name `symbol`
-    void insert(std::string symbol, Symbol::Kind kind, FuxType type);    
+    void insert(SymbolId symbol, Symbol::Kind kind, FuxType type);    
     // erase all symbols named `symbol`
-    void erase(std::string symbol);
+    void erase(SymbolId symbol);
 
     auto begin();
     auto end();
@@ -15,6 +15,7 @@
 #include "../../backend/llvmheader.hpp"
 #include "../../backend/generator/wrapper.hpp"
 #include "../lexer/token.hpp"
+#include "../../util/symbols.hpp"
 #include "../parser/type.hpp"
 #include "../parser/value.hpp"
 #include "expr.hpp"
@@ -25,203 +26,193 @@ typedef map<string, FuxType> ArgMap;
 /// EXPRESSIONS ///
 
 class NullExprAST : public ExprAST {
-public:    
+public:
+    NullExprAST() : ExprAST(AST::NullExprAST) {}
+
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;    
 };
 
 class BoolExprAST : public ExprAST {
-    ValueStruct *value;
-
 public:
-    BoolExprAST(bool value) : value(new ValueStruct(value)) {}
-    ~BoolExprAST();
+    ValueStruct value;
+
+    BoolExprAST(bool value) : ExprAST(AST::BoolExprAST), value(value) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class NumberExprAST : public ExprAST {
-    ValueStruct *value;
-
 public:
+    ValueStruct value;
+
     template<typename T>
-    NumberExprAST(T value) : value(new ValueStruct(value)) {}
-    ~NumberExprAST();
+    NumberExprAST(T value) : ExprAST(AST::NumberExprAST), value(value) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class CharExprAST : public ExprAST {
-    ValueStruct *value;
-
 public:
+    ValueStruct value;
+
     template<typename T>
-    CharExprAST(T value) : value(new ValueStruct(value)) {}
-    ~CharExprAST();
+    CharExprAST(T value) : ExprAST(AST::CharExprAST), value(value) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class StringExprAST : public ExprAST {
-    ValueStruct *value;
-
 public:
-    StringExprAST(string value) : value(new ValueStruct(value)) {}
-    ~StringExprAST();
+    ValueStruct value;
+    const LiteralPool *literals; // of the file
+
+    StringExprAST(LiteralPool &literals, string_view value) 
+    : ExprAST(AST::StringExprAST), value(ValueStruct::literal(literals, value)), literals(&literals) {}
+    StringExprAST(const LiteralPool &literals, ValueStruct value) 
+    : ExprAST(AST::StringExprAST), value(value), literals(&literals) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override; 
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class RangeExprAST : public ExprAST {
+public:
     ExprAST::Ptr begin; 
     ExprAST::Ptr end; 
 
-public:
     RangeExprAST(ExprAST::Ptr &begin, ExprAST::Ptr &end) 
-    : begin(std::move(begin)), end(std::move(end)) {}
+    : ExprAST(AST::RangeExprAST), begin(std::move(begin)), end(std::move(end)) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;  
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class ArrayExprAST : public ExprAST {
+public:
     ExprAST::Vec elements;
     
-public:
-    ArrayExprAST(ExprAST::Vec &elements) : elements(std::move(elements)) {}
+    ArrayExprAST(ExprAST::Vec &elements) : ExprAST(AST::ArrayExprAST), elements(std::move(elements)) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override; 
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class VariableExprAST : public ExprAST {
-    string name;
-
 public:
-    VariableExprAST(const string& name) : name(name) {}
+    SymbolId name;
+
+    VariableExprAST(SymbolId name) : ExprAST(AST::VariableExprAST), name(name) {}
     ~VariableExprAST() override;
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;  
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class MemberExprAST : public ExprAST {
+public:
     ExprAST::Ptr base;
     ExprAST::Ptr member;
 
-public:
     MemberExprAST(ExprAST::Ptr &base, ExprAST::Ptr &member) 
-    : base(std::move(base)), member(std::move(member)) {}
+    : ExprAST(AST::MemberExprAST), base(std::move(base)), member(std::move(member)) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;    
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class CallExprAST : public ExprAST {
+public:
     ExprAST::Ptr callee;
     ExprAST::Vec args;
     bool asyncCall;
 
-public:
-    CallExprAST(const string &callee, ExprAST::Vec &args, bool asyncCall = false)
-    : callee(make_unique<VariableExprAST>(callee)), args(std::move(args)), asyncCall(asyncCall) {}
+    CallExprAST(SymbolId callee, ExprAST::Vec &args, bool asyncCall = false)
+    : ExprAST(AST::CallExprAST), callee(make_unique<VariableExprAST>(callee)), args(std::move(args)), asyncCall(asyncCall) {}
     CallExprAST(ExprAST::Ptr &callee, ExprAST::Vec &args, bool asyncCall = false)
-    : callee(std::move(callee)), args(std::move(args)), asyncCall(asyncCall) {}
+    : ExprAST(AST::CallExprAST), callee(std::move(callee)), args(std::move(args)), asyncCall(asyncCall) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override; 
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class UnaryExprAST : public ExprAST {
+public:
     UnaryOp op;
     ExprAST::Ptr expr;
 
-public:
-    UnaryExprAST(UnaryOp op, ExprAST::Ptr &expr) : op(op), expr(std::move(expr)) {}
+    UnaryExprAST(UnaryOp op, ExprAST::Ptr &expr) : ExprAST(AST::UnaryExprAST), op(op), expr(std::move(expr)) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;  
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class BinaryExprAST : public ExprAST {
+public:
     BinaryOp op;
     ExprAST::Ptr LHS, RHS;
 
-public:
-    BinaryExprAST(BinaryOp op, ExprAST::Ptr &LHS, ExprAST::Ptr &RHS = nullExpr) 
-    : op(op), LHS(std::move(LHS)), RHS(std::move(RHS)) {}
+    BinaryExprAST(BinaryOp op, ExprAST::Ptr &LHS) 
+    : ExprAST(AST::BinaryExprAST), op(op), LHS(std::move(LHS)), RHS(nullptr) {}
+    BinaryExprAST(BinaryOp op, ExprAST::Ptr &LHS, ExprAST::Ptr &RHS) 
+    : ExprAST(AST::BinaryExprAST), op(op), LHS(std::move(LHS)), RHS(std::move(RHS)) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;   
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class TypeCastExprAST : public ExprAST {
+public:
     FuxType type;
     ExprAST::Ptr expr;
 
-public:
     TypeCastExprAST(FuxType type, ExprAST::Ptr &expr) 
-    : type(type), expr(std::move(expr)) {}
+    : ExprAST(AST::TypeCastExprAST), type(type), expr(std::move(expr)) {}
     
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class TernaryExprAST : public ExprAST {
+public:
     ExprAST::Ptr condition;
     ExprAST::Ptr thenExpr;
     ExprAST::Ptr elseExpr;
 
-public:
     TernaryExprAST(ExprAST::Ptr &condition, ExprAST::Ptr &thenExpr, ExprAST::Ptr &elseExpr)
-    : condition(std::move(condition)), thenExpr(std::move(thenExpr)), elseExpr(std::move(elseExpr)) {}
+    : ExprAST(AST::TernaryExprAST), condition(std::move(condition)), thenExpr(std::move(thenExpr)), elseExpr(std::move(elseExpr)) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override; 
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
@@ -230,77 +221,78 @@ public:
 
 class NoOperationAST : public StmtAST {
 public:
+    NoOperationAST() : StmtAST(AST::NoOperationAST) {}
+
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;    
 };
 
 class VariableDeclAST : public StmtAST {
-    string symbol;
+public:
+    SymbolId symbol;
     FuxType type;
     ExprAST::Ptr value;
 
-public:
-    VariableDeclAST(string symbol, FuxType type = FuxType(), ExprAST::Ptr &value = nullExpr) 
-    : symbol(symbol), type(type), value(std::move(value)) {}
+    VariableDeclAST(SymbolId symbol, FuxType type = FuxType()) 
+    : StmtAST(AST::VariableDeclAST), symbol(symbol), type(type), value(nullptr) {}
+    VariableDeclAST(SymbolId symbol, FuxType type, ExprAST::Ptr &value) 
+    : StmtAST(AST::VariableDeclAST), symbol(symbol), type(type), value(std::move(value)) {}
     ~VariableDeclAST() override;
     
-    string &getSymbol();
+    SymbolId &getSymbol();
     FuxType &getType();
     ExprAST::Ptr &getValue();
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
-typedef unique_ptr<VariableDeclAST> VarDeclPtr; 
+typedef unique_ptr<VariableDeclAST, StmtAST::Delete> VarDeclPtr; 
 
 class InbuiltCallAST : public StmtAST {
+public:
     Inbuilts callee;
     ExprAST::Vec arguments;
 
-public:
     InbuiltCallAST(Inbuilts callee, ExprAST::Vec &arguments) 
-    : callee(callee), arguments(std::move(arguments)) {}
+    : StmtAST(AST::InbuiltCallAST), callee(callee), arguments(std::move(arguments)) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class IfElseAST : public StmtAST {
+public:
     ExprAST::Ptr condition;
     StmtAST::Ptr thenBody;
     StmtAST::Ptr elseBody;
 
-public:
-    IfElseAST(ExprAST::Ptr &condition, StmtAST::Ptr &thenBody, StmtAST::Ptr &elseBody = nullStmt)
-    : condition(std::move(condition)), thenBody(std::move(thenBody)), elseBody(std::move(elseBody)) {}
+    IfElseAST(ExprAST::Ptr &condition, StmtAST::Ptr &thenBody)
+    : StmtAST(AST::IfElseAST), condition(std::move(condition)), thenBody(std::move(thenBody)), elseBody(nullptr) {}
+    IfElseAST(ExprAST::Ptr &condition, StmtAST::Ptr &thenBody, StmtAST::Ptr &elseBody)
+    : StmtAST(AST::IfElseAST), condition(std::move(condition)), thenBody(std::move(thenBody)), elseBody(std::move(elseBody)) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class CodeBlockAST : public StmtAST {
+public:
     StmtAST::Vec body;
 
-public:
-    CodeBlockAST() : body(StmtAST::Vec()) {}
-    CodeBlockAST(StmtAST::Vec &body) : body(std::move(body)) {}
+    CodeBlockAST() : StmtAST(AST::CodeBlockAST), body(StmtAST::Vec()) {}
+    CodeBlockAST(StmtAST::Vec &body) : StmtAST(AST::CodeBlockAST), body(std::move(body)) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
  
@@ -308,110 +300,123 @@ public:
 };
 
 class WhileLoopAST : public StmtAST {
+public:
     ExprAST::Ptr condition;
     StmtAST::Ptr body;
     bool postCondition;
 
-public:
     WhileLoopAST(ExprAST::Ptr &condition, StmtAST::Ptr &body, bool postCondition = false)
-    : condition(std::move(condition)), body(std::move(body)), postCondition(postCondition) {}
+    : StmtAST(AST::WhileLoopAST), condition(std::move(condition)), body(std::move(body)), postCondition(postCondition) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
 class ForLoopAST : public StmtAST {
+public:
     bool forEach;
     /*for (*/StmtAST::Ptr initial; 
             ExprAST::Ptr condition; 
             ExprAST::Ptr iterator;//) {
         StmtAST::Ptr body;
     // }
-public:
+
     ForLoopAST(StmtAST::Ptr &initial, ExprAST::Ptr &iterator, StmtAST::Ptr &body)
-    : forEach(true), initial(std::move(initial)), condition(nullptr), 
+    : StmtAST(AST::ForLoopAST), forEach(true), initial(std::move(initial)), condition(nullptr), 
         iterator(std::move(iterator)), body(std::move(body)) {}
     ForLoopAST(StmtAST::Ptr &initial, ExprAST::Ptr &condition, ExprAST::Ptr &iterator, StmtAST::Ptr &body)
-    : forEach(false), initial(std::move(initial)), condition(std::move(condition)),
+    : StmtAST(AST::ForLoopAST), forEach(false), initial(std::move(initial)), condition(std::move(condition)),
         iterator(std::move(iterator)), body(std::move(body)) {}
 
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
 };
 
-typedef unique_ptr<CodeBlockAST> BlockPtr;
+typedef unique_ptr<CodeBlockAST, StmtAST::Delete> BlockPtr;
 
 // prototype of a function
 // name and arguments
 class PrototypeAST : public StmtAST {
+public:
     FuxType type;
-    string symbol;
+    SymbolId symbol;
     StmtAST::Vec args;
 
-public:
-    typedef unique_ptr<PrototypeAST> Ptr;
+    typedef unique_ptr<PrototypeAST, StmtAST::Delete> Ptr;
 
-    PrototypeAST(FuxType type, const string &symbol, StmtAST::Vec &args)
-    : type(type), symbol(symbol), args(std::move(args)) {}
+    PrototypeAST(FuxType type, SymbolId symbol, StmtAST::Vec &args)
+    : StmtAST(AST::PrototypeAST), type(type), symbol(symbol), args(std::move(args)) {}
     ~PrototypeAST() override;
     
     FUX_BC(Function *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
     
-    string &getSymbol();
+    SymbolId &getSymbol();
     StmtAST::Vec &getArgs();
 };
 
 class FunctionAST : public StmtAST {
+public:
     PrototypeAST::Ptr proto;
     StmtAST::Ptr body;
     StmtAST::Vec locals; // local variables that are declared in this function
 
-public:
-    typedef unique_ptr<FunctionAST> Ptr;
+    typedef unique_ptr<FunctionAST, StmtAST::Delete> Ptr;
 
-    FunctionAST(FuxType type, const string &symbol, StmtAST::Vec &args)
-    : proto(make_unique<PrototypeAST>(type, symbol, args)), body(nullptr), locals(StmtAST::Vec()) {}
+    FunctionAST(FuxType type, SymbolId symbol, StmtAST::Vec &args)
+    : StmtAST(AST::FunctionAST), proto(make_unique<PrototypeAST>(type, symbol, args)), body(nullptr), locals(StmtAST::Vec()) {}
     FunctionAST(PrototypeAST::Ptr &proto, StmtAST::Ptr &body)
-    : proto(std::move(proto)), body(std::move(body)) {}
+    : StmtAST(AST::FunctionAST), proto(std::move(proto)), body(std::move(body)) {}
 
     FUX_BC(Function *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;    
 
     void setBody(StmtAST::Ptr &body);
     void addLocal(StmtAST::Ptr &local);
+    // parse the body with parse the first time it is needed
+    void setLazyBody(std::function<void(FunctionAST &)> parse);
+    // body (and locals), parsed first if needed; thread-safe
+    StmtAST::Ptr &getBody();
+
+private:
+    std::once_flag parsed;
+    std::function<void(FunctionAST &)> parseBody; // sets body and locals if they are parsed on demand
 };
 
 class RootAST : public StmtAST {
+public:
     StmtAST::Vec program;
     // resting place for array size expressions
     // FuxTypes refer to these by IDs
     ExprAST::Vec arraySizeExprs; 
+    // contents of the string literals of the file
+    LiteralPool literals;
 
-public:
-    typedef unique_ptr<RootAST> Ptr;
+    typedef unique_ptr<RootAST, StmtAST::Delete> Ptr;
     typedef vector<Ptr> Vec;
 
-    RootAST() : program(StmtAST::Vec()) {}        
+    RootAST() : StmtAST(AST::RootAST), program(StmtAST::Vec()) {
+        if (Arena *arena = Arena::owner(this))
+            arena->finalize(&literals);
+    }
     
     FUX_BC(Value *codegen(LLVMWrapper *fuxLLVM) override;)
     StmtAST::Ptr analyse(Expectation exp) override;
-    AST getASTType() override;
     FuxType getFuxType() override;
     void debugPrint(size_t indent = 0) override;
  
     void addSub(StmtAST::Ptr &sub);
     _i64 addSizeExpr(ExprAST::Ptr &sizeExpr);
+    size_t countSizeExprs();
+    // move the statements and array size expressions of other behind the own ones
+    // (the size ids of other have to start at countSizeExprs())
+    void append(RootAST &other);
 };
\ No newline at end of file
@@ -0,0 +1,264 @@
+/**
+ * @file cache.cpp
+ * @author fuechs
+ * @brief fux ast cache
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "cache.hpp"
+#include "../../util/symbols.hpp"
+
+#include <cstdio>
+#include <unordered_map>
+
+// every bit of x changes about half of the bits of the result (finalizer of murmur3)
+static uint64_t mix(uint64_t x) {
+    x = (x ^ (x >> 33)) * 0xff51afd7ed558ccdull;
+    x = (x ^ (x >> 33)) * 0xc4ceb53a2dc0ec4bull;
+    return x ^ (x >> 33);
+}
+
+uint64_t ASTCache::hash(string_view source) {
+    uint64_t value = 14695981039346656037ull;
+    size_t i = 0;
+    for (uint64_t word; i + 8 <= source.size(); i += 8) {
+        memcpy(&word, source.data() + i, 8);
+        value = mix(value ^ word);
+    }
+    uint64_t rest = 0; // the last bytes, padded with zeros
+    if (i < source.size())
+        memcpy(&rest, source.data() + i, source.size() - i);
+    return mix(mix(value ^ rest) ^ source.size());
+}
+
+string ASTCache::path(const string &sourcePath) {
+    const size_t dot = sourcePath.rfind('.');
+    if (dot == string::npos || sourcePath.find('/', dot) != string::npos)
+        return sourcePath + ".fuxast";
+    return sourcePath.substr(0, dot) + ".fuxast";
+}
+
+bool ASTCache::hasSymbol(AST kind) {
+    return kind == AST::VariableExprAST || kind == AST::VariableDeclAST || kind == AST::PrototypeAST;
+}
+
+bool ASTCache::hasType(AST kind) {
+    return kind == AST::TypeCastExprAST || kind == AST::VariableDeclAST || kind == AST::PrototypeAST;
+}
+
+bool ASTCache::write(const string &path, const FlatAST &flat, const SourceBuffer &source, const string &fileName) {
+    string strings;
+    auto addString = [&](string_view text) -> String {
+        const String added = {(uint32_t) strings.size(), (uint32_t) text.size()};
+        strings.append(text);
+        return added;
+    };
+
+    // symbol and type ids are only valid in this process
+    vector<String> symbols;
+    std::unordered_map<SymbolId, uint32_t> localSymbols;
+    auto addSymbol = [&](SymbolId symbol) -> uint32_t {
+        auto [it, added] = localSymbols.try_emplace(symbol, symbols.size());
+        if (added)
+            symbols.push_back(addString(fuxSymbols[symbol]));
+        return it->second;
+    };
+
+    vector<Type> types;
+    std::unordered_map<TypeId, uint32_t> localTypes;
+    auto addType = [&](FuxType type) -> uint32_t {
+        auto [it, added] = localTypes.try_emplace(type.id(), types.size());
+        if (added)
+            types.push_back({type->kind, type->access, type->array, 0, type->pointerDepth, type->sizeID,
+                addString(fuxSymbols[type->name])});
+        return it->second;
+    };
+
+    vector<FlatAST::Node> nodes = flat.nodes;
+    for (FlatAST::Node &node : nodes) {
+        if (node.flags & FlatAST::Node::MISSING)
+            continue;
+        if (hasSymbol(node.kind))
+            node.data = addSymbol(node.data);
+        if (hasType(node.kind))
+            node.type = addType(FuxType::byId(node.type));
+    }
+
+    vector<Value> values = vector<Value>(flat.values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        const ValueStruct &value = flat.values[i];
+        values[i].type = addType(value.type);
+        values[i].bits = value.__u64;
+    }
+    const string literals = flat.literals.image();
+
+    Header header = Header();
+    memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.order = byteOrder;
+    header.nodeSize = sizeof(FlatAST::Node);
+    header.sourceLines = source.lines();
+    header.sourceSize = source.size();
+    header.sourceHash = hash(source.view());
+    header.fileName = addString(fileName);
+
+    string bytes = string(sizeof(Header), '\0');
+    auto addSection = [&](const void *data, size_t count, size_t size) -> Section {
+        bytes.resize((bytes.size() + 7) & ~(size_t) 7); // sections are aligned to 8 bytes
+        const Section added = {bytes.size(), count};
+        bytes.append((const char *) data, count * size);
+        return added;
+    };
+    header.nodes = addSection(nodes.data(), nodes.size(), sizeof(FlatAST::Node));
+    header.values = addSection(values.data(), values.size(), sizeof(Value));
+    header.types = addSection(types.data(), types.size(), sizeof(Type));
+    header.symbols = addSection(symbols.data(), symbols.size(), sizeof(String));
+    header.strings = addSection(strings.data(), strings.size(), sizeof(char));
+    header.literals = addSection(literals.data(), literals.size(), sizeof(char));
+    header.checksum = hash(string_view(bytes).substr(sizeof(Header)));
+    memcpy(bytes.data(), &header, sizeof(Header));
+
+    // readers never see a partial file
+    const string temporary = path + ".tmp";
+    std::ofstream file(temporary, std::ios::binary);
+    if (!file.is_open())
+        return false;
+    file.write(bytes.data(), bytes.size());
+    file.close();
+    if (!file || std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool ASTCache::read(const string &path, const SourceBuffer &source, FlatAST &flat) {
+    const char *begin = nullptr;
+    size_t length = 0;
+    string owned;
+
+    #ifndef FUX_WIN
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && (size_t) info.st_size >= sizeof(Header)) {
+        void *mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            begin = (const char *) mapping;
+            length = info.st_size;
+        }
+    }
+    close(fd);
+    #else
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+        return false;
+    owned.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    begin = owned.data();
+    length = owned.size();
+    #endif
+
+    if (!begin)
+        return false;
+
+    auto section = [&](const Section &section, size_t size) {
+        return section.offset % 8 == 0 && section.offset <= length
+            && section.count <= (length - section.offset) / size;
+    };
+
+    Header header = Header();
+    if (length >= sizeof(Header))
+        memcpy(&header, begin, sizeof(Header));
+
+    bool valid = length >= sizeof(Header)
+        && memcmp(header.magic, magic, sizeof(magic)) == 0
+        && header.version == version
+        && header.order == byteOrder
+        && header.nodeSize == sizeof(FlatAST::Node)
+        && header.sourceSize == source.size()
+        && header.sourceLines == source.lines()
+        && section(header.nodes, sizeof(FlatAST::Node))
+        && section(header.values, sizeof(Value))
+        && section(header.types, sizeof(Type))
+        && section(header.symbols, sizeof(String))
+        && section(header.strings, sizeof(char))
+        && section(header.literals, sizeof(char))
+        && header.literals.count <= UINT32_MAX
+        && header.nodes.count > 0
+        // last, they read everything
+        && header.sourceHash == hash(source.view())
+        && header.checksum == hash(string_view(begin + sizeof(Header), length - sizeof(Header)));
+
+    FlatAST loaded;
+    const char *strings = begin + header.strings.offset;
+    auto readString = [&](const String &text) {
+        valid = valid && (uint64_t) text.offset + text.length <= header.strings.count;
+        return valid ? string(strings + text.offset, text.length) : string();
+    };
+
+    auto readType = [&](const Type &type) {
+        const FuxType::Kind kind = (FuxType::Kind) type.kind;
+        valid = valid && type.kind >= 0 && type.kind <= FuxType::NO_TYPE && (kind == FuxType::NO_TYPE || TypeTable::plain(kind))
+            && type.access < FuxType::bit(FuxType::PUBLIC) << 1 && type.array <= 1
+            // size ids refer to the array size expressions of the root
+            && type.sizeID >= -1 && type.sizeID < (int64_t) loaded.nodes[0].data;
+        const SymbolId name = fuxSymbols.intern(readString(type.name));
+        return valid ? FuxType(kind, type.pointerDepth, type.access, type.array, type.sizeID, name) : FuxType();
+    };
+
+    if (valid) {
+        const FlatAST::Node *nodes = (const FlatAST::Node *) (begin + header.nodes.offset);
+        loaded.nodes.assign(nodes, nodes + header.nodes.count);
+        loaded.literals.assign(string_view(begin + header.literals.offset, header.literals.count));
+
+        const String *symbols = (const String *) (begin + header.symbols.offset);
+        vector<SymbolId> symbolIds = vector<SymbolId>(header.symbols.count);
+        for (size_t i = 0; valid && i < symbolIds.size(); i++)
+            symbolIds[i] = fuxSymbols.intern(readString(symbols[i]));
+
+        const Type *types = (const Type *) (begin + header.types.offset);
+        FuxType::Vec typeIds;
+        typeIds.reserve(header.types.count);
+        for (size_t i = 0; valid && i < header.types.count; i++)
+            typeIds.push_back(readType(types[i]));
+
+        const Value *values = (const Value *) (begin + header.values.offset);
+        loaded.values.reserve(header.values.count);
+        for (size_t i = 0; valid && i < header.values.count; i++) {
+            if (!(valid = values[i].type < typeIds.size()))
+                break;
+            loaded.values.emplace_back(typeIds[values[i].type], values[i].bits);
+            const ValueStruct &value = loaded.values.back();
+            valid = value.type->kind != FuxType::LIT || loaded.literals.contains(value.__lit);
+        }
+
+        // relocate symbols and types and make sure every index stays in its table
+        const size_t count = loaded.nodes.size();
+        for (size_t i = 0; valid && i < count; i++) {
+            FlatAST::Node &node = loaded.nodes[i];
+            valid = node.size >= 1 && node.size <= count - i && node.kind <= AST::RootAST;
+            if (!valid || (node.flags & FlatAST::Node::MISSING))
+                continue;
+            if (hasSymbol(node.kind) && (valid = node.data < symbolIds.size()))
+                node.data = symbolIds[node.data];
+            if (hasType(node.kind) && (valid = valid && node.type < typeIds.size()))
+                node.type = typeIds[node.type].id();
+            if (node.kind >= AST::BoolExprAST && node.kind <= AST::StringExprAST)
+                valid = valid && node.data < loaded.values.size();
+        }
+        valid = valid && loaded.nodes[0].kind == AST::RootAST && loaded.nodes[0].size == count;
+    }
+
+    #ifndef FUX_WIN
+    munmap((void *) begin, length);
+    #endif
+
+    if (valid)
+        flat = std::move(loaded);
+    return valid;
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+/**
+ * @file cache.hpp
+ * @author fuechs
+ * @brief fux ast cache header
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#pragma once
+
+#include "../../fux.hpp"
+#include "../../util/buffer.hpp"
+#include "flat.hpp"
+
+// binary cache of the flat ast of a source file (.fuxast),
+// so packages that did not change don't have to be lexed and parsed again.
+// the file is a header followed by sections that only refer to each other by offsets
+// and indices, so it is loaded by mapping it and copying the nodes in one go;
+// symbol and type ids are local to the file and are interned again while loading.
+// a cache only belongs to the source with the same size and hash, else it is stale
+class ASTCache {
+public:
+    static constexpr uint32_t version = 4;
+
+    // hash of the contents of a source file (over words of 8 bytes, each one mixed in completely)
+    static uint64_t hash(string_view source);
+    // path of the cache of a source file
+    // "core/io.fux" --> "core/io.fuxast"
+    static string path(const string &sourcePath);
+
+    // write flat ast of source to path (replaces the file at once)
+    // returns false if the file could not be written
+    static bool write(const string &path, const FlatAST &flat, const SourceBuffer &source, const string &fileName = "");
+    // read the cache at path into flat
+    // returns false if it is missing, broken, from another version or stale for source
+    static bool read(const string &path, const SourceBuffer &source, FlatAST &flat);
+
+private:
+    // part of the string section
+    struct String {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    struct Section {
+        uint64_t offset;    // from the beginning of the file
+        uint64_t count;     // amount of entries
+    };
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t order;     // byteOrder as written, other machines read it swapped
+        uint32_t nodeSize;  // sizeof(FlatAST::Node)
+        uint32_t sourceLines;
+        uint64_t sourceSize;
+        uint64_t sourceHash;
+        uint64_t checksum;  // hash of everything after the header
+        String fileName;
+        Section nodes;      // FlatAST::Node, with indices into symbols and types instead of ids
+        Section values;     // Value
+        Section types;      // Type
+        Section symbols;    // String
+        Section strings;    // char
+        Section literals;   // char, image of the LiteralPool
+    };
+
+    struct Type {
+        int32_t kind;
+        uint16_t access;
+        uint8_t array;
+        uint8_t unused;
+        int64_t pointerDepth;
+        int64_t sizeID;
+        String name;
+    };
+
+    struct Value {
+        uint32_t type;      // index into types
+        uint32_t unused;
+        uint64_t bits;      // FuxType::LIT: offset and length in literals
+    };
+
+    static constexpr char magic[8] = {'F', 'U', 'X', 'A', 'S', 'T', 0, 0};
+    static constexpr uint32_t byteOrder = 0x01020304;
+
+    // whether node holds a symbol id in data
+    static bool hasSymbol(AST kind);
+    // whether node holds a type id in type
+    static bool hasType(AST kind);
+};
\ No newline at end of file
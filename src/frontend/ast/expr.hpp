@@ -16,15 +16,13 @@
 
 class ExprAST : public StmtAST {
 public:
-    typedef unique_ptr<ExprAST> Ptr;
-    typedef vector<Ptr> Vec;
+    typedef unique_ptr<ExprAST, StmtAST::Delete> Ptr;
+    typedef vector<Ptr, Arena::Allocator<Ptr>> Vec;
 
+    ExprAST(AST kind) : StmtAST(kind) {}
     virtual ~ExprAST() {}
     FUX_BC(virtual Value *codegen(LLVMWrapper *fuxLLVM) = 0;)
     virtual StmtAST::Ptr analyse(Expectation exp) = 0;
-    virtual AST getASTType() = 0;
     virtual FuxType getFuxType() = 0;
     virtual void debugPrint(size_t indent = 0) = 0;
-};
-
-extern ExprAST::Ptr nullExpr;
\ No newline at end of file
+};
\ No newline at end of file
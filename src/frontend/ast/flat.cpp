@@ -0,0 +1,256 @@
+/**
+ * @file flat.cpp
+ * @author fuechs
+ * @brief flat ast
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "flat.hpp"
+#include "visitor.hpp"
+
+// visits every node, which parses the lazy bodies of the functions
+class BodyParser : public ASTVisitor<BodyParser> {};
+
+// adds the nodes of the tree in pre-order
+class Flattener : public ASTVisitor<Flattener> {
+public:
+    Flattener(FlatAST &flat) : flat(flat) {}
+
+    // placeholder for a missing child
+    void visitNull() { flat.open(AST::NoOperationAST, 0, FlatAST::Node::MISSING); }
+
+    // nodes that only need their kind
+    void visitStmt(StmtAST &node) { 
+        FlatAST::Index index = flat.open(node.getASTType());
+        visitChildren(node);
+        flat.close(index);
+    }
+
+    void visitBoolExpr(BoolExprAST &node) { flat.open(AST::BoolExprAST, 0, 0, flat.addValue(node.value)); }
+    void visitNumberExpr(NumberExprAST &node) { flat.open(AST::NumberExprAST, 0, 0, flat.addValue(node.value)); }
+    void visitCharExpr(CharExprAST &node) { flat.open(AST::CharExprAST, 0, 0, flat.addValue(node.value)); }
+    void visitStringExpr(StringExprAST &node) { flat.open(AST::StringExprAST, 0, 0, flat.addValue(node.value)); }
+    void visitVariableExpr(VariableExprAST &node) { flat.open(AST::VariableExprAST, 0, 0, node.name); }
+
+    void visitCallExpr(CallExprAST &node) { 
+        close(flat.open(AST::CallExprAST, 0, node.asyncCall ? FlatAST::Node::ASYNC : 0), node); 
+    }
+    void visitUnaryExpr(UnaryExprAST &node) { close(flat.open(AST::UnaryExprAST, (uint8_t) node.op), node); }
+    void visitBinaryExpr(BinaryExprAST &node) { close(flat.open(AST::BinaryExprAST, (uint8_t) node.op), node); }
+    void visitTypeCastExpr(TypeCastExprAST &node) { 
+        close(flat.open(AST::TypeCastExprAST, 0, 0, 0, node.type.id()), node); 
+    }
+    void visitVariableDecl(VariableDeclAST &node) { 
+        close(flat.open(AST::VariableDeclAST, 0, 0, node.symbol, node.type.id()), node);
+    }
+    void visitInbuiltCall(InbuiltCallAST &node) { close(flat.open(AST::InbuiltCallAST, (uint8_t) node.callee), node); }
+    void visitWhileLoop(WhileLoopAST &node) { 
+        close(flat.open(AST::WhileLoopAST, 0, node.postCondition ? FlatAST::Node::POST : 0), node); 
+    }
+    // always 4 children
+    void visitForLoop(ForLoopAST &node) { 
+        close(flat.open(AST::ForLoopAST, 0, node.forEach ? FlatAST::Node::EACH : 0), node); 
+    }
+    void visitPrototype(PrototypeAST &node) { 
+        close(flat.open(AST::PrototypeAST, 0, 0, node.symbol, node.type.id()), node); 
+    }
+    // array size expressions, program
+    // (lazy bodies add array size expressions, so they are parsed before counting them)
+    void visitRoot(RootAST &node) { 
+        BodyParser().visit(&node);
+        close(flat.open(AST::RootAST, 0, 0, node.arraySizeExprs.size()), node); 
+    }
+
+private:
+    FlatAST &flat;
+
+    // add the children of node and finish it
+    void close(FlatAST::Index index, StmtAST &node) {
+        visitChildren(node);
+        flat.close(index);
+    }
+};
+
+// builds the nodes of the tree again (see Flattener for the order of the children)
+class Inflater {
+public:
+    Inflater(const FlatAST &flat, RootAST &root) : flat(flat), root(root) {}
+
+    StmtAST::Ptr stmt(FlatAST::Index index) {
+        const FlatAST::Node &node = flat.nodes[index];
+        if (node.flags & FlatAST::Node::MISSING)
+            return nullptr;
+
+        FlatAST::Index child = flat.child(index);
+        const FlatAST::Index end = flat.end(index);
+        switch (node.kind) {
+            case AST::NullExprAST:      return make_unique<NullExprAST>();
+            case AST::BoolExprAST: {
+                unique_ptr<BoolExprAST> value = make_unique<BoolExprAST>(false);
+                value->value = flat.values[node.data];
+                return value;
+            }
+            case AST::NumberExprAST:    return make_unique<NumberExprAST>(flat.values[node.data]);
+            case AST::CharExprAST:      return make_unique<CharExprAST>(flat.values[node.data]);
+            case AST::StringExprAST:    return make_unique<StringExprAST>(root.literals, flat.values[node.data]);
+            case AST::RangeExprAST: {
+                ExprAST::Ptr begin = nextExpr(child, end);
+                ExprAST::Ptr last = nextExpr(child, end);
+                return make_unique<RangeExprAST>(begin, last);
+            }
+            case AST::ArrayExprAST: {
+                ExprAST::Vec elements = exprs(child, end);
+                return make_unique<ArrayExprAST>(elements);
+            }
+            case AST::VariableExprAST:  return make_unique<VariableExprAST>(node.data);
+            case AST::MemberExprAST: {
+                ExprAST::Ptr base = nextExpr(child, end);
+                ExprAST::Ptr member = nextExpr(child, end);
+                return make_unique<MemberExprAST>(base, member);
+            }
+            case AST::CallExprAST: {
+                ExprAST::Ptr callee = nextExpr(child, end);
+                ExprAST::Vec args = exprs(child, end);
+                return make_unique<CallExprAST>(callee, args, node.flags & FlatAST::Node::ASYNC);
+            }
+            case AST::UnaryExprAST: {
+                ExprAST::Ptr expr = nextExpr(child, end);
+                return make_unique<UnaryExprAST>((UnaryOp) node.op, expr);
+            }
+            case AST::BinaryExprAST: {
+                ExprAST::Ptr LHS = nextExpr(child, end);
+                ExprAST::Ptr RHS = nextExpr(child, end);
+                return make_unique<BinaryExprAST>((BinaryOp) node.op, LHS, RHS);
+            }
+            case AST::TypeCastExprAST: {
+                ExprAST::Ptr expr = nextExpr(child, end);
+                return make_unique<TypeCastExprAST>(FuxType::byId(node.type), expr);
+            }
+            case AST::TernaryExprAST: {
+                ExprAST::Ptr condition = nextExpr(child, end);
+                ExprAST::Ptr thenExpr = nextExpr(child, end);
+                ExprAST::Ptr elseExpr = nextExpr(child, end);
+                return make_unique<TernaryExprAST>(condition, thenExpr, elseExpr);
+            }
+            case AST::NoOperationAST:   return make_unique<NoOperationAST>();
+            case AST::VariableDeclAST: {
+                ExprAST::Ptr value = nextExpr(child, end);
+                return make_unique<VariableDeclAST>(node.data, FuxType::byId(node.type), value);
+            }
+            case AST::InbuiltCallAST: {
+                ExprAST::Vec args = exprs(child, end);
+                return make_unique<InbuiltCallAST>((Inbuilts) node.op, args);
+            }
+            case AST::IfElseAST: {
+                ExprAST::Ptr condition = nextExpr(child, end);
+                StmtAST::Ptr thenBody = next(child, end);
+                StmtAST::Ptr elseBody = next(child, end);
+                return make_unique<IfElseAST>(condition, thenBody, elseBody);
+            }
+            case AST::CodeBlockAST: {
+                StmtAST::Vec body = stmts(child, end);
+                return make_unique<CodeBlockAST>(body);
+            }
+            case AST::PrototypeAST: {
+                StmtAST::Vec args = stmts(child, end);
+                return make_unique<PrototypeAST>(FuxType::byId(node.type), node.data, args);
+            }
+            case AST::FunctionAST: { // proto, locals, body
+                PrototypeAST::Ptr proto = PrototypeAST::Ptr(static_cast<PrototypeAST *>(next(child, end).release()));
+                StmtAST::Ptr body = nullptr;
+                FunctionAST::Ptr function = make_unique<FunctionAST>(proto, body);
+                while (child < end) {
+                    StmtAST::Ptr stmt = next(child, end);
+                    if (child < end)
+                        function->addLocal(stmt);
+                    else
+                        function->setBody(stmt);
+                }
+                return function;
+            }
+            case AST::WhileLoopAST: {
+                ExprAST::Ptr condition = nextExpr(child, end);
+                StmtAST::Ptr body = next(child, end);
+                return make_unique<WhileLoopAST>(condition, body, node.flags & FlatAST::Node::POST);
+            }
+            case AST::ForLoopAST: {
+                StmtAST::Ptr initial = next(child, end);
+                ExprAST::Ptr condition = nextExpr(child, end);
+                ExprAST::Ptr iterator = nextExpr(child, end);
+                StmtAST::Ptr body = next(child, end);
+                if (node.flags & FlatAST::Node::EACH)
+                    return make_unique<ForLoopAST>(initial, iterator, body);
+                return make_unique<ForLoopAST>(initial, condition, iterator, body);
+            }
+            case AST::RootAST:          break; // only the first node
+        }
+        return nullptr;
+    }
+
+    ExprAST::Ptr expr(FlatAST::Index index) { return ExprAST::Ptr(static_cast<ExprAST *>(stmt(index).release())); }
+
+private:
+    const FlatAST &flat;
+    RootAST &root;
+
+    // the child at child (nullptr after the last one), moves child to its sibling
+    StmtAST::Ptr next(FlatAST::Index &child, FlatAST::Index end) {
+        if (child >= end)
+            return nullptr;
+        StmtAST::Ptr node = stmt(child);
+        child = flat.next(child);
+        return node;
+    }
+    ExprAST::Ptr nextExpr(FlatAST::Index &child, FlatAST::Index end) { 
+        return ExprAST::Ptr(static_cast<ExprAST *>(next(child, end).release())); 
+    }
+
+    StmtAST::Vec stmts(FlatAST::Index child, FlatAST::Index end) {
+        StmtAST::Vec list = StmtAST::Vec();
+        while (child < end)
+            list.push_back(next(child, end));
+        return list;
+    }
+    ExprAST::Vec exprs(FlatAST::Index child, FlatAST::Index end) {
+        ExprAST::Vec list = ExprAST::Vec();
+        while (child < end)
+            list.push_back(nextExpr(child, end));
+        return list;
+    }
+};
+
+FlatAST::FlatAST(RootAST &root) : literals(root.literals) { Flattener(*this).visit(&root); }
+
+RootAST::Ptr FlatAST::tree() const {
+    RootAST::Ptr root = make_unique<RootAST>();
+    root->literals = literals;
+    Inflater inflater = Inflater(*this, *root);
+    Index child = this->child(0);
+    for (uint32_t i = 0; i < nodes[0].data; i++, child = next(child))
+        root->arraySizeExprs.push_back(inflater.expr(child));
+    for (; child < end(0); child = next(child))
+        root->program.push_back(inflater.stmt(child));
+    return root;
+}
+
+size_t FlatAST::bytes() const {
+    return nodes.capacity() * sizeof(Node)
+        + values.capacity() * sizeof(ValueStruct)
+        + literals.bytes();
+}
+
+FlatAST::Index FlatAST::open(AST kind, uint8_t op, uint16_t flags, uint32_t data, uint32_t type) {
+    nodes.push_back({kind, op, flags, 1, data, type});
+    return nodes.size() - 1;
+}
+
+void FlatAST::close(Index node) { nodes[node].size = nodes.size() - node; }
+
+uint32_t FlatAST::addValue(const ValueStruct &value) {
+    values.push_back(value);
+    return values.size() - 1;
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+/**
+ * @file flat.hpp
+ * @author fuechs
+ * @brief flat ast header
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#pragma once
+
+#include "../../fux.hpp"
+#include "../analyser/expectation.hpp"
+#include "../parser/type.hpp"
+#include "../parser/value.hpp"
+#include "stmt.hpp"
+
+class RootAST;
+
+// the AST as one contiguous array of nodes in pre-order:
+// the subtree of node i is [i, i + size), its first child is i + 1
+// and the sibling after child c is c + size of c.
+// payloads that don't fit into a node are kept in side tables
+class FlatAST {
+public:
+    typedef uint32_t Index;
+
+    struct Node {
+        enum Flags : uint16_t {
+            MISSING = 1 << 0,   // placeholder for a child that is nullptr in the tree
+            ASYNC   = 1 << 1,   // CallExprAST: async call
+            POST    = 1 << 2,   // WhileLoopAST: do ... while
+            EACH    = 1 << 3,   // ForLoopAST: for each
+        };
+
+        AST kind;
+        uint8_t op;     // BinaryOp, UnaryOp, Inbuilts
+        uint16_t flags;
+        Index size;     // amount of nodes in this subtree (including this one)
+        uint32_t data;  // SymbolId; index of value; amount of array size expressions (RootAST)
+        TypeId type;    // VariableDeclAST, PrototypeAST, TypeCastExprAST
+    };
+
+    FlatAST() {}
+    FlatAST(RootAST &root);
+
+    // the nodes as a tree again (allocated from the current arena)
+    unique_ptr<RootAST, StmtAST::Delete> tree() const;
+
+    Node &operator[](Index index) { return nodes[index]; }
+    size_t size() const { return nodes.size(); }
+    size_t bytes() const;
+
+    // iterate over the children of node
+    Index child(Index node) const { return node + 1; }
+    Index next(Index node) const { return node + nodes[node].size; }
+    Index end(Index node) const { return node + nodes[node].size; }
+    bool missing(Index node) const { return nodes[node].flags & Node::MISSING; }
+
+    // add a node whose children will follow, finish it with close()
+    Index open(AST kind, uint8_t op = 0, uint16_t flags = 0, uint32_t data = 0, uint32_t type = 0);
+    void close(Index node);
+    uint32_t addValue(const ValueStruct &value);
+
+    // same as StmtAST::analyse, in one pass over the nodes
+    void analyse(Expectation exp);
+    // same output as RootAST::debugPrint
+    void debugPrint();
+
+    vector<Node> nodes;
+    vector<ValueStruct> values;
+    LiteralPool literals;   // copy of the literals of the file
+
+private:
+    // see callASTDebug() and debugBody() in debug.cpp
+    void debugPrint(Index node, size_t indent);
+    void debugStmt(Index node, size_t indent, const char *null = "NULLSTMT");
+    void debugExpr(Index node, size_t indent);
+    void debugBody(Index node, size_t indent);
+};
\ No newline at end of file
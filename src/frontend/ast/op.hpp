@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <array>
+
 #include "../lexer/token.hpp"
 
 enum class BinaryOp {
@@ -57,6 +59,48 @@ enum class BinaryOp {
 
 string BinaryOpValue(BinaryOp &op);
 
+// binding power of binary operators, loosest first
+// (NONE: token does not continue an expression)
+enum class Precedence : uint8_t {
+    NONE,
+    ASSIGNMENT,     // = === += ... (also ++ --, see Token::isAssignment())
+    PIPE,           // << >>
+    TERNARY,        // ? :
+    LOR,            // ||
+    LAND,           // &&
+    BOR,            // |
+    BXOR,           // ><
+    BAND,           // &
+    EQUALITY,       // == !=
+    RELATIONAL,     // < > <= >=
+    SHIFT,          // <| |>
+    ADDITIVE,       // + -
+    MULTIPLICATIVE, // * / %
+    POWER,          // ^
+};
+
+// precedence of every TokenType when it follows an operand
+constexpr std::array<Precedence, NONE + 1> BinaryOpPrecedence = [] {
+    std::array<Precedence, NONE + 1> table {};
+    for (int type = EQUALS; type <= SWAP; type++)
+        table[type] = Precedence::ASSIGNMENT;
+    table[(int) BinaryOp::LMOV] = table[(int) BinaryOp::RMOV] = Precedence::PIPE;
+    table[QUESTION] = Precedence::TERNARY;
+    table[(int) BinaryOp::LOR] = Precedence::LOR;
+    table[(int) BinaryOp::LAND] = Precedence::LAND;
+    table[(int) BinaryOp::BOR] = Precedence::BOR;
+    table[(int) BinaryOp::BXOR] = Precedence::BXOR;
+    table[(int) BinaryOp::BAND] = Precedence::BAND;
+    table[EQUALS_EQUALS] = table[(int) BinaryOp::UNEQUAL] = Precedence::EQUALITY;
+    for (int type = (int) BinaryOp::LESST; type <= (int) BinaryOp::GTE; type++)
+        table[type] = Precedence::RELATIONAL;
+    table[(int) BinaryOp::LSH] = table[(int) BinaryOp::RSH] = Precedence::SHIFT;
+    table[(int) BinaryOp::ADD] = table[(int) BinaryOp::SUB] = Precedence::ADDITIVE;
+    table[(int) BinaryOp::MUL] = table[(int) BinaryOp::DIV] = table[(int) BinaryOp::MOD] = Precedence::MULTIPLICATIVE;
+    table[(int) BinaryOp::POW] = Precedence::POWER;
+    return table;
+}();
+
 enum class UnaryOp {
     POS = PLUS,             // positive +
     NEG = MINUS,            // negative -
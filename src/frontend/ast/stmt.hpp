@@ -13,8 +13,9 @@
 
 #include "../analyser/expectation.hpp"
 #include "../metadata.hpp"
+#include "../../util/arena.hpp"
 
-enum class AST {
+enum class AST : uint8_t {
     // expressions
     NullExprAST,
     BoolExprAST,
@@ -46,19 +47,38 @@ enum class AST {
 
 class StmtAST {
 public:
-    typedef unique_ptr<StmtAST> Ptr;
-    typedef vector<Ptr> Vec;
+    // nodes from an arena are not destroyed one by one: 
+    // their arena frees all of them at once (see Arena::finalize())
+    struct Delete {
+        Delete() = default;
+        template<typename T>
+        Delete(const std::default_delete<T> &) {}
 
+        void operator()(StmtAST *node) const {
+            if (!Arena::owner(node))
+                delete node;
+        }
+    };
+
+    typedef unique_ptr<StmtAST, Delete> Ptr;
+    typedef vector<Ptr, Arena::Allocator<Ptr>> Vec;
+
+    StmtAST(AST kind) : kind(kind) {}
+    // nodes are allocated from the arena of the file that is parsed
+    static void *operator new(size_t size) { return Arena::create(size); }
+    static void operator delete(void *ptr) { Arena::release(ptr); }
     virtual ~StmtAST() {}
     FUX_BC(virtual Value *codegen(LLVMWrapper *fuxLLVM) = 0;)
     virtual Ptr analyse(Expectation exp) = 0;
-    virtual AST getASTType() = 0;
+    // not virtual, so passes can switch over it cheaply (see visitor.hpp)
+    AST getASTType() const { return kind; }
     virtual FuxType getFuxType() = 0;
     virtual void debugPrint(size_t indent = 0) = 0;
 
     bool isExpr();
 
     Metadata meta = Metadata();
-};
 
-extern StmtAST::Ptr nullStmt;
\ No newline at end of file
+private:
+    const AST kind;
+};
\ No newline at end of file
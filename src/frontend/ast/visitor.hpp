@@ -0,0 +1,190 @@
+/**
+ * @file visitor.hpp
+ * @author fuechs
+ * @brief fux ast visitor header
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#pragma once
+
+#include "ast.hpp"
+
+// pass over the ast that dispatches with a switch over the kind of a node
+// instead of a virtual function per node class (CRTP):
+// Pass derives from ASTVisitor<Pass, Result> and hides the handlers of the kinds it cares about.
+// by default a handler falls back to visitExpr() or visitStmt(), which visit the children
+template<typename Pass, typename Result = void>
+class ASTVisitor {
+public:
+    // call the handler for the kind of node (visitNull() for nullptr)
+    Result visit(StmtAST *node) {
+        if (!node)
+            return pass().visitNull();
+
+        switch (node->getASTType()) {
+            case AST::NullExprAST:      return pass().visitNullExpr(static_cast<NullExprAST &>(*node));
+            case AST::BoolExprAST:      return pass().visitBoolExpr(static_cast<BoolExprAST &>(*node));
+            case AST::NumberExprAST:    return pass().visitNumberExpr(static_cast<NumberExprAST &>(*node));
+            case AST::CharExprAST:      return pass().visitCharExpr(static_cast<CharExprAST &>(*node));
+            case AST::StringExprAST:    return pass().visitStringExpr(static_cast<StringExprAST &>(*node));
+            case AST::RangeExprAST:     return pass().visitRangeExpr(static_cast<RangeExprAST &>(*node));
+            case AST::ArrayExprAST:     return pass().visitArrayExpr(static_cast<ArrayExprAST &>(*node));
+            case AST::VariableExprAST:  return pass().visitVariableExpr(static_cast<VariableExprAST &>(*node));
+            case AST::MemberExprAST:    return pass().visitMemberExpr(static_cast<MemberExprAST &>(*node));
+            case AST::CallExprAST:      return pass().visitCallExpr(static_cast<CallExprAST &>(*node));
+            case AST::UnaryExprAST:     return pass().visitUnaryExpr(static_cast<UnaryExprAST &>(*node));
+            case AST::BinaryExprAST:    return pass().visitBinaryExpr(static_cast<BinaryExprAST &>(*node));
+            case AST::TypeCastExprAST:  return pass().visitTypeCastExpr(static_cast<TypeCastExprAST &>(*node));
+            case AST::TernaryExprAST:   return pass().visitTernaryExpr(static_cast<TernaryExprAST &>(*node));
+            case AST::NoOperationAST:   return pass().visitNoOperation(static_cast<NoOperationAST &>(*node));
+            case AST::VariableDeclAST:  return pass().visitVariableDecl(static_cast<VariableDeclAST &>(*node));
+            case AST::InbuiltCallAST:   return pass().visitInbuiltCall(static_cast<InbuiltCallAST &>(*node));
+            case AST::IfElseAST:        return pass().visitIfElse(static_cast<IfElseAST &>(*node));
+            case AST::CodeBlockAST:     return pass().visitCodeBlock(static_cast<CodeBlockAST &>(*node));
+            case AST::PrototypeAST:     return pass().visitPrototype(static_cast<PrototypeAST &>(*node));
+            case AST::FunctionAST:      return pass().visitFunction(static_cast<FunctionAST &>(*node));
+            case AST::WhileLoopAST:     return pass().visitWhileLoop(static_cast<WhileLoopAST &>(*node));
+            case AST::ForLoopAST:       return pass().visitForLoop(static_cast<ForLoopAST &>(*node));
+            case AST::RootAST:          return pass().visitRoot(static_cast<RootAST &>(*node));
+        }
+        assert(!"unknown kind of node");
+        return Result();
+    }
+
+    template<typename T>
+    Result visit(const unique_ptr<T, StmtAST::Delete> &node) { return visit(node.get()); }
+
+    // visit the children of node in order, including missing ones
+    // (array size expressions before the program, locals before the body of functions)
+    void visitChildren(StmtAST &node) {
+        switch (node.getASTType()) {
+            case AST::RangeExprAST: {
+                RangeExprAST &range = static_cast<RangeExprAST &>(node);
+                visit(range.begin);
+                visit(range.end);
+                break;
+            }
+            case AST::ArrayExprAST:
+                for (ExprAST::Ptr &element : static_cast<ArrayExprAST &>(node).elements)
+                    visit(element);
+                break;
+            case AST::MemberExprAST: {
+                MemberExprAST &member = static_cast<MemberExprAST &>(node);
+                visit(member.base);
+                visit(member.member);
+                break;
+            }
+            case AST::CallExprAST: {
+                CallExprAST &call = static_cast<CallExprAST &>(node);
+                visit(call.callee);
+                for (ExprAST::Ptr &arg : call.args)
+                    visit(arg);
+                break;
+            }
+            case AST::UnaryExprAST:     visit(static_cast<UnaryExprAST &>(node).expr); break;
+            case AST::BinaryExprAST: {
+                BinaryExprAST &binary = static_cast<BinaryExprAST &>(node);
+                visit(binary.LHS);
+                visit(binary.RHS);
+                break;
+            }
+            case AST::TypeCastExprAST:  visit(static_cast<TypeCastExprAST &>(node).expr); break;
+            case AST::TernaryExprAST: {
+                TernaryExprAST &ternary = static_cast<TernaryExprAST &>(node);
+                visit(ternary.condition);
+                visit(ternary.thenExpr);
+                visit(ternary.elseExpr);
+                break;
+            }
+            case AST::VariableDeclAST:  visit(static_cast<VariableDeclAST &>(node).value); break;
+            case AST::InbuiltCallAST:
+                for (ExprAST::Ptr &arg : static_cast<InbuiltCallAST &>(node).arguments)
+                    visit(arg);
+                break;
+            case AST::IfElseAST: {
+                IfElseAST &ifElse = static_cast<IfElseAST &>(node);
+                visit(ifElse.condition);
+                visit(ifElse.thenBody);
+                visit(ifElse.elseBody);
+                break;
+            }
+            case AST::CodeBlockAST:
+                for (StmtAST::Ptr &stmt : static_cast<CodeBlockAST &>(node).body)
+                    visit(stmt);
+                break;
+            case AST::PrototypeAST:
+                for (StmtAST::Ptr &arg : static_cast<PrototypeAST &>(node).args)
+                    visit(arg);
+                break;
+            case AST::FunctionAST: {
+                FunctionAST &function = static_cast<FunctionAST &>(node);
+                StmtAST::Ptr &body = function.getBody();
+                visit(function.proto);
+                for (StmtAST::Ptr &local : function.locals)
+                    visit(local);
+                visit(body);
+                break;
+            }
+            case AST::WhileLoopAST: {
+                WhileLoopAST &loop = static_cast<WhileLoopAST &>(node);
+                visit(loop.condition);
+                visit(loop.body);
+                break;
+            }
+            case AST::ForLoopAST: {
+                ForLoopAST &loop = static_cast<ForLoopAST &>(node);
+                visit(loop.initial);
+                visit(loop.condition);
+                visit(loop.iterator);
+                visit(loop.body);
+                break;
+            }
+            case AST::RootAST: {
+                RootAST &root = static_cast<RootAST &>(node);
+                for (ExprAST::Ptr &sizeExpr : root.arraySizeExprs)
+                    visit(sizeExpr);
+                for (StmtAST::Ptr &stmt : root.program)
+                    visit(stmt);
+                break;
+            }
+            default: // no children
+                break;
+        }
+    }
+
+    Result visitNull() { return Result(); }
+    Result visitStmt(StmtAST &node) { visitChildren(node); return Result(); }
+    Result visitExpr(ExprAST &node) { return pass().visitStmt(node); }
+
+    Result visitNullExpr(NullExprAST &node)             { return pass().visitExpr(node); }
+    Result visitBoolExpr(BoolExprAST &node)             { return pass().visitExpr(node); }
+    Result visitNumberExpr(NumberExprAST &node)         { return pass().visitExpr(node); }
+    Result visitCharExpr(CharExprAST &node)             { return pass().visitExpr(node); }
+    Result visitStringExpr(StringExprAST &node)         { return pass().visitExpr(node); }
+    Result visitRangeExpr(RangeExprAST &node)           { return pass().visitExpr(node); }
+    Result visitArrayExpr(ArrayExprAST &node)           { return pass().visitExpr(node); }
+    Result visitVariableExpr(VariableExprAST &node)     { return pass().visitExpr(node); }
+    Result visitMemberExpr(MemberExprAST &node)         { return pass().visitExpr(node); }
+    Result visitCallExpr(CallExprAST &node)             { return pass().visitExpr(node); }
+    Result visitUnaryExpr(UnaryExprAST &node)           { return pass().visitExpr(node); }
+    Result visitBinaryExpr(BinaryExprAST &node)         { return pass().visitExpr(node); }
+    Result visitTypeCastExpr(TypeCastExprAST &node)     { return pass().visitExpr(node); }
+    Result visitTernaryExpr(TernaryExprAST &node)       { return pass().visitExpr(node); }
+    Result visitNoOperation(NoOperationAST &node)       { return pass().visitStmt(node); }
+    Result visitVariableDecl(VariableDeclAST &node)     { return pass().visitStmt(node); }
+    Result visitInbuiltCall(InbuiltCallAST &node)       { return pass().visitStmt(node); }
+    Result visitIfElse(IfElseAST &node)                 { return pass().visitStmt(node); }
+    Result visitCodeBlock(CodeBlockAST &node)           { return pass().visitStmt(node); }
+    Result visitPrototype(PrototypeAST &node)           { return pass().visitStmt(node); }
+    Result visitFunction(FunctionAST &node)             { return pass().visitStmt(node); }
+    Result visitWhileLoop(WhileLoopAST &node)           { return pass().visitStmt(node); }
+    Result visitForLoop(ForLoopAST &node)               { return pass().visitStmt(node); }
+    Result visitRoot(RootAST &node)                     { return pass().visitStmt(node); }
+
+protected:
+    Pass &pass() { return static_cast<Pass &>(*this); }
+};
\ No newline at end of file
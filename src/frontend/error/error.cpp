@@ -11,61 +11,73 @@
 
 #include "error.hpp"
 
-ErrorManager::ErrorManager() : _errors(ParseError::Vec()), 
-    errorCount(0), warningCount(0), sources(SourceMap()) {}
+static std::atomic<uint64_t> managers = 0;
+
+ErrorManager::ErrorManager(bool deferred) 
+: id(++managers), deferred(deferred), errorCount(0), warningCount(0), sequence(0) {}
 
 ErrorManager::~ErrorManager() {
-    _errors.clear();
-    sources.clear();
+    if (!deferred)
+        report();
 }
 
-void ErrorManager::addSourceFile(const string &fileName, const vector<string> &sourceLines) { sources[fileName] = sourceLines; }
+void ErrorManager::addSourceFile(const string &fileName, const SourceBuffer *buffer) { 
+    std::lock_guard<std::mutex> lock(mutex);
+    auto [it, added] = fileIndices.try_emplace(fileName, files.size());
+    if (added)
+        files.push_back({fileName, buffer});
+    else
+        files[it->second].buffer = buffer;
+}
 
 void ErrorManager::createError(
-    ParseError::Type type, string title,
+    ParseError::Type type, string_view title,
     // subject
     const string &subjectFile,
     size_t subjectFstLine, size_t subjectLstLine, 
     size_t subjectFstCol, size_t subjectLstCol,
-    string subjectInfo, size_t subjectPtr, string subjectPtrText,
+    string_view subjectInfo, size_t subjectPtr, string_view subjectPtrText,
     // reference
     const string &refFile,
     size_t refFstLine, size_t refLstLine, 
     size_t refFstCol, size_t refLstCol,
-    string refInfo, size_t refPtr, string refPtrText,
+    string_view refInfo, size_t refPtr, string_view refPtrText,
     // other
-    vector<string> notes, bool reference, bool warning, bool aggressive 
+    const vector<string> &notes, bool reference, bool warning, bool aggressive 
 ) {
-    Metadata subjectMeta = Metadata(&subjectFile, &sources.at(subjectFile),
-        subjectFstLine, subjectLstLine, subjectFstCol, subjectLstCol);
-    Metadata refMeta = Metadata(&refFile, &sources.at(refFile),
-        refFstLine, refLstLine, refFstCol, refLstCol);
-    ParseError::FlagVec flags = {};
-    if (reference)
-        flags.push_back(ParseError::REFERENCE);
-    if (warning)
-        flags.push_back(ParseError::WARNING);
-    if (aggressive)
-        flags.push_back(ParseError::AGGRESSIVE);
-    ParseError pe = ParseError(flags, type, title, 
-        ParseError::SUBJ_STRCT(subjectMeta, subjectInfo, subjectPtrText, subjectPtr),
-        ParseError::SUBJ_STRCT(refMeta, refInfo, refPtrText, refPtr),
-        notes);
-    pe.report();
-    _errors.push_back(pe);
-    
-    if (warning)
-        warningCount++;
-    else
-        errorCount++;
+    if (fuxCancel.cancelled()) // only follow-up errors
+        return;
+
+    Buffer &buffer = local();
+    Record record;
+    record.sequence = sequence++;
+    record.type = type;
+    record.flags = (reference ? 1 << ParseError::REFERENCE : 0) 
+        | (warning ? 1 << ParseError::WARNING : 0)
+        | (aggressive ? 1 << ParseError::AGGRESSIVE : 0);
+    record.title = buffer.add(title);
+    record.subject = {fileIndex(buffer, subjectFile), 
+        (uint32_t) subjectFstLine, (uint32_t) subjectLstLine, (uint32_t) subjectFstCol, (uint32_t) subjectLstCol,
+        (uint32_t) subjectPtr, buffer.add(subjectInfo), buffer.add(subjectPtrText)};
+    record.reference = {fileIndex(buffer, refFile), 
+        (uint32_t) refFstLine, (uint32_t) refLstLine, (uint32_t) refFstCol, (uint32_t) refLstCol,
+        (uint32_t) refPtr, buffer.add(refInfo), buffer.add(refPtrText)};
+    record.notes = {(uint32_t) buffer.text.size(), 0};
+    for (const string &note : notes) {
+        buffer.text.append(note);
+        buffer.text.push_back('\0');
+    }
+    record.notes.length = buffer.text.size() - record.notes.offset;
+    buffer.records.push_back(record);
+    count(warning);
 }
 
 void ErrorManager::simpleError(
-    ParseError::Type type, string title,
+    ParseError::Type type, string_view title,
     const string &file,
     size_t fstLine, size_t lstLine,
     size_t fstCol, size_t lstCol,
-    string info, vector<string> notes, 
+    string_view info, const vector<string> &notes, 
     bool warning, bool aggressive) {
         createError(
             type, title, 
@@ -75,12 +87,12 @@ void ErrorManager::simpleError(
         );
 }
 
-void ErrorManager::simpleError(ParseError::Type type, string title,
+void ErrorManager::simpleError(ParseError::Type type, string_view title,
     const string &file,
     size_t fstLine, size_t lstLine,
     size_t fstCol, size_t lstCol, 
-    string info, size_t ptr, string ptrText, 
-    vector<string> notes, bool warning, bool aggressive) {
+    string_view info, size_t ptr, string_view ptrText, 
+    const vector<string> &notes, bool warning, bool aggressive) {
         createError(
             type, title, 
             file, fstLine, lstLine, fstCol, lstCol,
@@ -90,6 +102,124 @@ void ErrorManager::simpleError(ParseError::Type type, string title,
         );
 }
 
+void ErrorManager::adopt(ErrorManager *other) {
+    std::lock_guard<std::mutex> lock(other->mutex);
+    vector<std::pair<const Record *, const Buffer *>> adopted = other->records();
+    std::sort(adopted.begin(), adopted.end(), [](const auto &a, const auto &b) { 
+        return a.first->sequence < b.first->sequence; 
+    });
+
+    Buffer &buffer = local();
+    auto move = [&](Position position, const Buffer &from) {
+        position.file = fileIndex(buffer, other->files[position.file].name);
+        position.info = buffer.add(from[position.info]);
+        position.pointerText = buffer.add(from[position.pointerText]);
+        return position;
+    };
+    for (auto &[that, from] : adopted) {
+        if (fuxCancel.cancelled())
+            break;
+        Record record = *that;
+        record.sequence = sequence++;
+        record.title = buffer.add((*from)[that->title]);
+        record.notes = buffer.add((*from)[that->notes]);
+        record.subject = move(that->subject, *from);
+        record.reference = move(that->reference, *from);
+        buffer.records.push_back(record);
+        count(record.flags & 1 << ParseError::WARNING);
+    }
+    for (unique_ptr<Buffer> &old : other->buffers)
+        old->records.clear();
+}
+
+void ErrorManager::report() {
+    std::lock_guard<std::mutex> lock(mutex);
+    vector<std::pair<const Record *, const Buffer *>> reported = records();
+    if (reported.empty())
+        return;
+
+    std::sort(reported.begin(), reported.end(), [](const auto &a, const auto &b) {
+        const Position &x = a.first->subject, &y = b.first->subject;
+        return std::tie(x.file, x.fstLine, x.fstCol, a.first->sequence) 
+            < std::tie(y.file, y.fstLine, y.fstCol, b.first->sequence);
+    });
+
+    stringstream out;
+    for (auto &[record, buffer] : reported) {
+        auto subject = [&](const Position &position) {
+            const Metadata meta = Metadata(&files[position.file].name, files[position.file].buffer, 
+                position.fstLine, position.lstLine, position.fstCol, position.lstCol);
+            return ParseError::SUBJ_STRCT(meta, (*buffer)[position.info], (*buffer)[position.pointerText], position.pointer);
+        };
+        vector<string_view> notes;
+        string_view text = (*buffer)[record->notes];
+        for (size_t end; (end = text.find('\0')) != string_view::npos; text.remove_prefix(end + 1))
+            notes.push_back(text.substr(0, end));
+        ParseError(record->flags, record->type, (*buffer)[record->title], 
+            subject(record->subject), subject(record->reference), std::move(notes)).print(out);
+    }
+
+    const string rendered = out.str();
+    cerr.write(rendered.data(), rendered.size());
+    cerr.flush();
+
+    for (unique_ptr<Buffer> &buffer : buffers) {
+        buffer->records.clear();
+        buffer->text.clear();
+    }
+}
+
 size_t ErrorManager::errors() { return errorCount; }
 
-size_t ErrorManager::warnings() { return warningCount; }
\ No newline at end of file
+size_t ErrorManager::warnings() { return warningCount; }
+
+void ErrorManager::count(bool warning) {
+    if (warning) {
+        warningCount++;
+        return;
+    }
+
+    const size_t count = ++errorCount;
+    if (!deferred && (fux.options.aggressiveErrors || (fux.options.errorLimit && count >= fux.options.errorLimit)))
+        fuxCancel.cancel();
+}
+
+ErrorManager::Text ErrorManager::Buffer::add(string_view added) {
+    const Text that = {(uint32_t) text.size(), (uint32_t) added.size()};
+    text.append(added);
+    return that;
+}
+
+ErrorManager::Buffer &ErrorManager::local() {
+    thread_local uint64_t lastManager = 0;
+    thread_local Buffer *last = nullptr;
+    if (lastManager == id)
+        return *last;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    Buffer *&buffer = threadBuffers[std::this_thread::get_id()];
+    if (!buffer) {
+        buffers.push_back(make_unique<Buffer>());
+        buffer = buffers.back().get();
+    }
+    lastManager = id;
+    last = buffer;
+    return *buffer;
+}
+
+uint32_t ErrorManager::fileIndex(Buffer &buffer, const string &name) {
+    if (buffer.file != UINT32_MAX && buffer.fileName == name)
+        return buffer.file;
+    std::lock_guard<std::mutex> lock(mutex);
+    buffer.file = fileIndices.at(name);
+    buffer.fileName = name;
+    return buffer.file;
+}
+
+vector<std::pair<const ErrorManager::Record *, const ErrorManager::Buffer *>> ErrorManager::records() {
+    vector<std::pair<const Record *, const Buffer *>> all;
+    for (const unique_ptr<Buffer> &buffer : buffers)
+        for (const Record &record : buffer->records)
+            all.push_back({&record, buffer.get()});
+    return all;
+}
\ No newline at end of file
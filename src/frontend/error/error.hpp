@@ -11,53 +11,127 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 #include "parseerror.hpp"
+#include "../../util/cancel.hpp"
 
+// diagnostics are recorded as they are into a buffer per thread, so recording is cheap
+// and safe while files are lexed and parsed concurrently; they are only rendered
+// by report() (at the end of a phase), ordered by their position in the source.
+// too many errors trip fuxCancel, later ones are only follow-ups and dropped
 class ErrorManager {
 public:
-    typedef map<string, vector<string>> SourceMap;
-
-    ErrorManager();
+    // deferred: never report (e.g. for worker threads), the errors are taken over with adopt()
+    ErrorManager(bool deferred = false);
+    // reports what is left unless deferred
     ~ErrorManager();
 
-    void addSourceFile(const string &fileName, const vector<string> &sourceLines);
+    ErrorManager(const ErrorManager &) = delete;
+    ErrorManager &operator=(const ErrorManager &) = delete;
+
+    void addSourceFile(const string &fileName, const SourceBuffer *buffer);
 
     void createError(
-        ParseError::Type type, string title,
+        ParseError::Type type, string_view title,
         // subject
         const string &subjectFile,
         size_t subjectFstLine, size_t subjectLstLine, 
         size_t subjectFstCol, size_t subjectLstCol,
-        string subjectInfo, size_t subjectPtr, string subjectPtrText,
+        string_view subjectInfo, size_t subjectPtr, string_view subjectPtrText,
         // reference
         const string &refFile,
         size_t refFstLine, size_t refLstLine, 
         size_t refFstCol, size_t refLstCol,
-        string refInfo, size_t refPtr, string refPtrText,
+        string_view refInfo, size_t refPtr, string_view refPtrText,
         // other
-        vector<string> notes, bool reference, bool warning, bool aggressive
+        const vector<string> &notes, bool reference, bool warning, bool aggressive
     );
 
-    void simpleError(ParseError::Type type, string title,
+    void simpleError(ParseError::Type type, string_view title,
         const string &file,
         size_t fstLine, size_t lstLine,
         size_t fstCol, size_t lstCol,
-        string info, vector<string> notes = {}, 
+        string_view info, const vector<string> &notes = {}, 
         bool warning = false, bool aggressive = false);
     
-    void simpleError(ParseError::Type type, string title,
+    void simpleError(ParseError::Type type, string_view title,
         const string &file,
         size_t fstLine, size_t lstLine, 
         size_t fstCol, size_t lstCol, 
-        string info, size_t ptr, string ptrText, 
-        vector<string> notes = {}, bool warning = false, bool aggressive = false);
+        string_view info, size_t ptr, string_view ptrText, 
+        const vector<string> &notes = {}, bool warning = false, bool aggressive = false);
+
+    // take over the errors of another (deferred) manager
+    void adopt(ErrorManager *other);
+
+    // render the recorded errors in source order with a single write to cerr and drop them
+    // (no thread may record at the same time)
+    void report();
 
     size_t errors();
     size_t warnings();
 
 private:
-    ParseError::Vec _errors;
-    size_t errorCount;
-    size_t warningCount;
-    SourceMap sources;
+    // part of the text of a buffer
+    struct Text {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    struct Position {
+        uint32_t file;      // index into files
+        uint32_t fstLine, lstLine, fstCol, lstCol;
+        uint32_t pointer;
+        Text info;
+        Text pointerText;
+    };
+
+    struct Record {
+        uint64_t sequence;  // order of recording, for errors at the same position
+        ParseError::Type type;
+        ParseError::FlagMask flags;
+        Text title;
+        Text notes;         // each one ends with '\0'
+        Position subject, reference;
+    };
+
+    struct Buffer {
+        vector<Record> records;
+        string text;
+        string fileName;    // last file that was looked up
+        uint32_t file = UINT32_MAX;
+
+        Text add(string_view added);
+        string_view operator[](Text that) const { return string_view(text).substr(that.offset, that.length); }
+    };
+
+    struct File {
+        string name;
+        const SourceBuffer *buffer;
+    };
+
+    // buffer of the current thread
+    Buffer &local();
+    // index of file (needs the buffer of the current thread)
+    uint32_t fileIndex(Buffer &buffer, const string &name);
+    // count an error or a warning, trip fuxCancel when there are too many errors
+    void count(bool warning);
+    // all records with their buffers (needs the lock)
+    vector<std::pair<const Record *, const Buffer *>> records();
+
+    const uint64_t id;  // unique for every manager, so threads can remember their buffer
+    bool deferred;
+    std::atomic<size_t> errorCount;
+    std::atomic<size_t> warningCount;
+    std::atomic<uint64_t> sequence;
+
+    std::mutex mutex;
+    vector<File> files;
+    map<string, uint32_t> fileIndices;
+    vector<unique_ptr<Buffer>> buffers;
+    std::unordered_map<std::thread::id, Buffer *> threadBuffers;
 };
\ No newline at end of file
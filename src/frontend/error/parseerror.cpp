@@ -11,235 +11,142 @@
 
 #include "parseerror.hpp"
 
-ParseError::SUBJ_STRCT::SUBJ_STRCT(Metadata meta, string info, string pointerText, size_t pointer) {
-    this->meta = meta;
-    this->info = info;
-    this->pointerText = pointerText;
-    this->pointer = pointer;
-}
-
-ParseError::SUBJ_STRCT::~SUBJ_STRCT() {
-    info.clear();
-    pointerText.clear();
-}
-
-ParseError::SUBJ_STRCT &ParseError::SUBJ_STRCT::operator=(const SUBJ_STRCT &copy) {
-    meta = copy.meta;
-    info = copy.info;
-    pointer = copy.pointer;
-    pointerText = copy.pointerText;
-    return *this;
-}
-
-ParseError::ParseError() {
-    flags = FlagVec();
-    type = UNKNOWN_ERROR;
-    title = "";
-    subject = SUBJ_STRCT();
-    reference = SUBJ_STRCT();
-    notes = vector<string>();
-}
+ParseError::ParseError(FlagMask flags, Type type, string_view title, SUBJ_STRCT subject, SUBJ_STRCT reference, vector<string_view> notes)
+: flags(flags), type(type), title(title), subject(subject), reference(reference), notes(std::move(notes)) {}
 
-ParseError::ParseError(FlagVec flags, Type type, string title, SUBJ_STRCT subject, SUBJ_STRCT reference, vector<string> notes) {
-    this->flags = flags;
-    this->type = type;
-    this->title = title;
-    this->subject = subject;
-    this->reference = reference;
-    this->notes = notes;
-}
-
-ParseError::~ParseError() { 
-    flags.clear(); 
-    title.clear();
-}
-
-void ParseError::report() {
-    if (hasFlag(REPORTED) /* || !fux.options.warnings && hasFlag(WARNING) */)
-        return;
-    flags.push_back(REPORTED);
-
-    stringstream ss = stringstream();
+void ParseError::print(std::ostream &out) {
     padding = to_string(std::max({subject.meta.lstLine, reference.meta.lstLine})).size() + 3;
 
-    ss << printHead();
-    ss << printSubject(subject);
+    printHead(out);
+    printSubject(out, subject);
     if (hasFlag(REFERENCE))
-        ss << printSubject(reference);
-    ss << printNotes();
-
-    cerr << ss.str();
+        printSubject(out, reference);
+    printNotes(out);
 }
 
-constexpr bool ParseError::hasFlag(Flag flag) {
-    return find(flags.begin(), flags.end(), flag) != flags.end();
-}
-
-void ParseError::addNote(string note) { notes.push_back(note); }
-
-string ParseError::pad(size_t sub, char fill) {
-    string ret = "";
+void ParseError::pad(std::ostream &out, size_t sub, char fill) {
     for (sub = padding - sub; sub --> 0;)
-        ret += fill;
-    return ret;
+        out << fill;
 }
 
-string ParseError::tripleDot() {
-    stringstream ss;
-    ss << CC::BLUE << "..." << pad(3) << "|\t" << CC::GRAY << "...\n" << CC::DEFAULT;
-    return ss.str();
+void ParseError::tripleDot(std::ostream &out) {
+    out << CC::BLUE << "...";
+    pad(out, 3);
+    out << "|\t" << CC::GRAY << "...\n" << CC::DEFAULT;
 }
 
-string ParseError::printSubject(const SUBJ_STRCT &subj) { 
-    stringstream ss;
+void ParseError::printSubject(std::ostream &out, const SUBJ_STRCT &subj) { 
     const Metadata &meta = subj.meta;
 
-    ss << printPosition(meta);
+    printPosition(out, meta);
     if (meta.fstLine == meta.lstLine) {
-        ss << printLine(meta.fstLine, meta[meta.fstLine]);
-        ss << printUnderline(meta.fstCol, meta.lstCol, subj.pointer);
-        ss << printInfo(subj.info);
-        ss << printArrow(subj);
+        printLine(out, meta.fstLine, meta[meta.fstLine]);
+        printUnderline(out, meta.fstCol, meta.lstCol, subj.pointer);
+        printInfo(out, subj.info);
+        printArrow(out, subj);
     } else if (meta.lstLine - meta.fstLine > 6) {
-        ss << printLine(meta.fstLine, meta[meta.fstLine]);
-        ss << tripleDot();
-        ss << printLine(meta.lstLine, meta[meta.lstLine]);
-        ss << printInfo(subj.info, true);
+        printLine(out, meta.fstLine, meta[meta.fstLine]);
+        tripleDot(out);
+        printLine(out, meta.lstLine, meta[meta.lstLine]);
+        printInfo(out, subj.info, true);
     } else {
         for (size_t i = meta.fstLine; i <= meta.lstLine; i++) 
-            ss << printLine(i, meta[i]);
-        ss << printInfo(subj.info, true);
+            printLine(out, i, meta[i]);
+        printInfo(out, subj.info, true);
     }
-
-    return ss.str();
 }
 
-string ParseError::printHead() {
-    stringstream ss;
-    ss << SC::BOLD;
+void ParseError::printHead(std::ostream &out) {
+    out << SC::BOLD;
     if (/*!fux.options.werrors &&*/ hasFlag(WARNING)) 
-        ss << CC::MAGENTA << "[warning]";
+        out << CC::MAGENTA << "[warning]";
     else 
-        ss << CC::RED << "[error]";
-    ss << CC::DEFAULT << "["; 
-    if (hasFlag(AGGRESSIVE)) ss << "A";
-    ss << "E" << type << "]: " << ErrorTypeString[type];
-    if (!title.empty()) ss << ": " << title;
-    ss << "\n" << SC::RESET;
-    return ss.str();
+        out << CC::RED << "[error]";
+    out << CC::DEFAULT << "["; 
+    if (hasFlag(AGGRESSIVE)) out << "A";
+    out << "E" << type << "]: " << ErrorTypeString[type];
+    if (!title.empty()) out << ": " << title;
+    out << "\n" << SC::RESET;
 }
 
-string ParseError::printPosition(const Metadata &meta) {
-    stringstream ss;
-    ss << pad(2) << CC::BLUE << SC::BOLD << ">>> " << SC::RESET
+void ParseError::printPosition(std::ostream &out, const Metadata &meta) {
+    pad(out, 2);
+    out << CC::BLUE << SC::BOLD << ">>> " << SC::RESET
         << *meta.file << ":" << meta.fstLine << ":" << meta.fstCol << "\n";
-    return ss.str();
 }
 
-string ParseError::printLine(size_t lineNumber, string line) {
-    stringstream ss;
-    string lineStr = to_string(lineNumber);
-    ss << CC::BLUE << SC::BOLD << lineStr << pad(lineStr.size()) << "|\t" << SC::RESET << CC::GRAY << line << "\n" << CC::DEFAULT;
-    return ss.str();
+void ParseError::printLine(std::ostream &out, size_t lineNumber, string_view line) {
+    const string lineStr = to_string(lineNumber);
+    out << CC::BLUE << SC::BOLD << lineStr;
+    pad(out, lineStr.size());
+    out << "|\t" << SC::RESET << CC::GRAY << line << "\n" << CC::DEFAULT;
 }
 
-string ParseError::printUnderline(size_t start, size_t end, size_t except) {
-    stringstream ss;
-    
-    ss << pad() << SC::BOLD << CC::RED << "|\t";
+void ParseError::printUnderline(std::ostream &out, size_t start, size_t end, size_t except) {
+    pad(out);
+    out << SC::BOLD << CC::RED << "|\t";
 
+    start = std::max<size_t>(start, 1); // columns start at 1, max would wrap around
     size_t i;
     size_t max = (except == 0 ? start  : std::min({start, except})) - 1;
     for (i = 1; i < max; i++) 
-        ss << " ";
+        out << " ";
     for (; i <= std::max({end, except}) + 1; i++) {
         if (except == 0) {
             for (;i >= start && i <= end; i++) 
-                ss << CC::RED << "^";
+                out << CC::RED << "^";
             break;
         }
 
         if (i == except - 1 || i == except + 1)
-            ss << " ";
+            out << " ";
         else if (i == except) 
-            ss << CC::RED << "^";
+            out << CC::RED << "^";
         else if (i >= start && i <= end) 
-            ss << CC::BLUE << "-";
+            out << CC::BLUE << "-";
         else
-            ss << " ";
+            out << " ";
     }
-    
-    // for (i = 0; i < (start - 1); i++) // -1 so arrow points at exact position
-    //     ss << " ";
-
-    // while (i++ < end) {
-    //     if (except == 0) {
-    //         ss << "^";
-    //         continue;
-    //     }
-
-    //     if (i == except - 1 || i == except + 1) 
-    //         ss << " ";
-    //     else if (i == except) 
-    //         ss << CC::RED << "^";
-    //     else 
-    //         ss << CC::BLUE << "-";
-    // }
-
-    ss << SC::RESET << " ";
-    return ss.str();
+
+    out << SC::RESET << " ";
 }
 
-string ParseError::printArrow(const SUBJ_STRCT &subj) {
+void ParseError::printArrow(std::ostream &out, const SUBJ_STRCT &subj) {
     if (subj.pointer == 0)
-        return "";
-    
-    const Metadata &meta = subj.meta;
-    stringstream ss;
+        return;
 
-    ss << pad() << CC::RED << SC::BOLD << "|\t";
+    pad(out);
+    out << CC::RED << SC::BOLD << "|\t";
     for (size_t i = 0; i < subj.pointer - 1; i++)
-        ss << " ";
-    ss << "|\n";
-    ss << pad() << "|\t";
+        out << " ";
+    out << "|\n";
+    pad(out);
+    out << "|\t";
     for (size_t i = 0; i != subj.pointer - 1; i++)
-        ss << " ";
-    ss << subj.pointerText << "\n" << SC::RESET;
-
-    return ss.str();
+        out << " ";
+    out << subj.pointerText << "\n" << SC::RESET;
 }
 
-string ParseError::printInfo(const string &info, bool wrap) {
-    if (info.empty())
-        return "\n";
-
-    stringstream ss;
-    ss << SC::BOLD << CC::RED;
-    if (wrap) 
-        ss << pad() << " \\___ " << info;
-    else 
-        ss << info;
-    ss << "\n" << SC::RESET;
-    return ss.str();
-}
+void ParseError::printInfo(std::ostream &out, string_view info, bool wrap) {
+    if (info.empty()) {
+        out << "\n";
+        return;
+    }
 
-string ParseError::printNotes() {
-    stringstream ss;
-    ss << CC::YELLOW << SC::BOLD;
-    for (const string &note : notes)
-        ss << pad() << "|\t" << note << "\n";
-    ss << SC::RESET;
-    return ss.str();
+    out << SC::BOLD << CC::RED;
+    if (wrap) {
+        pad(out);
+        out << " \\___ " << info;
+    } else 
+        out << info;
+    out << "\n" << SC::RESET;
 }
 
-// vector<string> ParseError::splitString(string data, size_t max) {
-//     vector<string> ret = {""};
-//     vector<string> tmp = vector<string>();
-//     tmp = split(data, ' ');
-//     for (string &word : tmp)
-//         if (ret.back().size() < max)
-//             ret.back() += word + " ";
-//         else
-//             ret.push_back(word + " ");
-//     return ret;
-// }
\ No newline at end of file
+void ParseError::printNotes(std::ostream &out) {
+    out << CC::YELLOW << SC::BOLD;
+    for (const string_view &note : notes) {
+        pad(out);
+        out << "|\t" << note << "\n";
+    }
+    out << SC::RESET;
+}
\ No newline at end of file
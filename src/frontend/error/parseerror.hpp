@@ -46,10 +46,9 @@ static const char *ErrorTypeString[] = {
     "Missing Paren",
 };
 
+// renders one diagnostic (see ErrorManager), the texts are only viewed
 class ParseError {
 public:
-    typedef vector<ParseError> Vec;
-
     enum Type {
         GENERIC,
 
@@ -87,52 +86,46 @@ public:
         REFERENCE,      // has a reference to another code
     };
 
-    typedef vector<Flag> FlagVec;
+    typedef uint8_t FlagMask; // 1 << Flag
 
     struct SUBJ_STRCT {
-        SUBJ_STRCT(Metadata meta = Metadata(), string info = "", string pointerText = "", size_t pointer = 0);
-        ~SUBJ_STRCT();
-
-        SUBJ_STRCT &operator=(const SUBJ_STRCT &copy);
+        SUBJ_STRCT(Metadata meta = Metadata(), string_view info = "", string_view pointerText = "", size_t pointer = 0)
+        : meta(meta), info(info), pointerText(pointerText), pointer(pointer) {}
 
         Metadata meta;
-        string info;
-        string pointerText;
+        string_view info;
+        string_view pointerText;
         size_t pointer;
     };
 
-    ParseError();
-    ParseError(FlagVec flags, Type type, string title, SUBJ_STRCT subject, SUBJ_STRCT reference = SUBJ_STRCT(), vector<string> notes = {});
-    ~ParseError();
+    ParseError(FlagMask flags, Type type, string_view title, SUBJ_STRCT subject, SUBJ_STRCT reference = SUBJ_STRCT(), vector<string_view> notes = {});
 
-    void report();
+    // write the diagnostic to out
+    void print(std::ostream &out);
 
-    constexpr bool hasFlag(Flag flag);
-    void addNote(string note);
+    constexpr bool hasFlag(Flag flag) { return flags & (1 << flag); }
 
 private:
-    FlagVec flags;
+    FlagMask flags;
     Type type;
         
-    string title;
+    string_view title;
     SUBJ_STRCT subject, reference;
     
-    vector<string> notes;
+    vector<string_view> notes;
 
     // helper functions for error reporting
     size_t padding = 3;
 
-    string pad(size_t sub = 0, char fill = ' ');
-    string tripleDot();
-
-    string printHead();
-    string printSubject(const SUBJ_STRCT &subj);
-    string printPosition(const Metadata &meta);
-    string printLine(size_t lineNumber, string line);
-    string printUnderline(size_t start, size_t end, size_t except = 0);
-    string printArrow(const SUBJ_STRCT &meta);
-    string printInfo(const string &info, bool wrap = false);
-    string printNotes();
-
-    // vector<string> splitString(string data, size_t max);
+    void pad(std::ostream &out, size_t sub = 0, char fill = ' ');
+    void tripleDot(std::ostream &out);
+
+    void printHead(std::ostream &out);
+    void printSubject(std::ostream &out, const SUBJ_STRCT &subj);
+    void printPosition(std::ostream &out, const Metadata &meta);
+    void printLine(std::ostream &out, size_t lineNumber, string_view line);
+    void printUnderline(std::ostream &out, size_t start, size_t end, size_t except = 0);
+    void printArrow(std::ostream &out, const SUBJ_STRCT &meta);
+    void printInfo(std::ostream &out, string_view info, bool wrap = false);
+    void printNotes(std::ostream &out);
 };
\ No newline at end of file
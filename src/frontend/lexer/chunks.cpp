@@ -0,0 +1,130 @@
+/**
+ * @file chunks.cpp
+ * @author fuechs
+ * @brief fux parallel chunked lexing
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "lexer.hpp"
+#include "../../util/threading.hpp"
+
+size_t Lexer::minChunkSize = 128 * 1024;
+
+size_t Lexer::chunks() {
+    const size_t chunks = source.length() / minChunkSize;
+    if (!fux.options.threading || chunks < 2)
+        return 1;
+    return std::max<size_t>(1, std::min(fuxThread::pool().workers(), chunks));
+}
+
+void Lexer::seek(size_t offset, size_t line, size_t col) {
+    idx = offset;
+    this->line = line;
+    this->col = col;
+    currentToken = Token(NONE, idx, 0, line);
+    tokenCol = col;
+}
+
+void Lexer::lexUntil(size_t stop) {
+    Token token;
+    while (idx < stop && !fuxCancel.cancelled()) {
+        getToken();
+        if (endToken(token))
+            tokens.push_back(token);
+    }
+}
+
+// a quick scan that only knows about comments and literals;
+// a wrong guess is caught while stitching the chunks together
+vector<Lexer::Chunk> Lexer::findChunks(size_t amount) {
+    vector<Chunk> chunks = {{0, 1}};
+    const char *begin = source.data();
+    const char *end = begin + source.length();
+    const size_t chunkSize = source.length() / amount;
+    size_t line = 1;
+
+    for (const char *it = begin; it < end && chunks.size() < amount;) {
+        switch (*it) {
+            case '\n':
+                ++line;
+                ++it;
+                if ((size_t) (it - begin) >= chunks.size() * chunkSize)
+                    chunks.push_back({(size_t) (it - begin), line});
+                break;
+            
+            case '/':
+            case '#':
+                if (it + 1 < end && (it[1] == '/' || (*it == '#' && it[1] == '!')))
+                    it = fuxScan::lineEnd(it, end); // the newline still ends the line
+                else if (it + 1 < end && it[1] == '*') {
+                    size_t lines = 0;
+                    const char *lastNewline = nullptr;
+                    it = std::min(fuxScan::commentEnd(it, end, lines, lastNewline) + 2, end);
+                    line += lines;
+                } else
+                    ++it;
+                break;
+            
+            case '"':
+                for (++it; it < end && *it != '"' && *it != '\n';)
+                    it += *it == '\\' ? 2 : 1;
+                if (it < end && *it == '"')
+                    ++it;
+                break;
+            
+            case '\'': {
+                const char *close = it + std::min<size_t>(it + 1 < end && it[1] == '\\' ? 4 : 3, end - it);
+                line += std::count(it, close, '\n');
+                it = close;
+                break;
+            }
+            
+            default:
+                ++it;
+                break;
+        }
+    }
+
+    return chunks;
+}
+
+void Lexer::lexParallel(size_t amount) {
+    const vector<Chunk> chunks = findChunks(amount);
+    auto stopOf = [&](size_t i) { return i + 1 < chunks.size() ? chunks[i + 1].offset : source.length(); };
+
+    vector<Lexer *> lexers;
+    fuxThread::TaskGroup group;
+    for (size_t i = 1; i < chunks.size(); i++) {
+        Lexer *lexer = new Lexer(buffer, fileName, new ErrorManager(true));
+        lexer->seek(chunks[i].offset, chunks[i].line);
+        lexers.push_back(lexer);
+        group.run([lexer, stop = stopOf(i)] { lexer->lexUntil(stop); }, fuxThread::ThreadPool::HIGH);
+    }
+
+    lexUntil(stopOf(0));
+    group.wait();
+
+    for (size_t i = 1; i < chunks.size(); i++) {
+        Lexer *lexer = lexers[i - 1];
+
+        // the chunk is only valid if the previous one ended exactly where it started
+        if (idx == chunks[i].offset && line == chunks[i].line && col == 1) {
+            const size_t first = tokens.size();
+            tokens.insert(tokens.end(), lexer->tokens.begin(), lexer->tokens.end());
+            if (!lexer->numbers.empty())
+                for (size_t i = first; i < tokens.size(); i++)
+                    if (tokens[i].isNumber() && tokens[i].payload & storedNumber)
+                        tokens[i].payload = storeNumber(tokens[i].type, lexer->number(tokens[i]));
+            error->adopt(lexer->error);
+            seek(lexer->idx, lexer->line, lexer->col);
+        } else 
+            lexUntil(stopOf(i));
+
+        delete lexer->error;
+        delete lexer;
+    }
+}
\ No newline at end of file
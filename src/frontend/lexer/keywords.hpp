@@ -0,0 +1,81 @@
+/**
+ * @file keywords.hpp
+ * @author fuechs
+ * @brief fux keyword lookup header
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ * 
+ */
+
+#pragma once
+
+#include "../../fux.hpp"
+#include "token.hpp"
+
+// perfect hash of all keywords (KEY_GET ... KEY_TEMPLATE),
+// generated at compile time from their spelling in TokenTypeValue
+namespace fuxKeywords {
+
+    constexpr size_t first = KEY_GET;
+    constexpr size_t last = KEY_TEMPLATE;
+    constexpr size_t tableSize = 512; // has to be a power of two
+    constexpr uint32_t maxSeed = 1 << 16;
+
+    // seeded FNV-1a, reduced to an index into the table
+    constexpr size_t hash(string_view word, uint32_t seed) {
+        uint32_t h = 2166136261u ^ seed;
+        for (const char &c : word)
+            h = (h ^ (uint8_t) c) * 16777619u;
+        return (h ^ (h >> 16)) & (tableSize - 1);
+    }
+
+    struct Table {
+        uint32_t seed = maxSeed; // maxSeed if no perfect hash was found
+        size_t maxLength = 0;
+        TokenType slots[tableSize] = {};
+    };
+
+    // try seeds until no two keywords share a slot
+    constexpr Table generate() {
+        for (uint32_t seed = 0; seed < maxSeed; seed++) {
+            Table table;
+            for (TokenType &slot : table.slots)
+                slot = IDENTIFIER;
+
+            bool perfect = true;
+            for (size_t type = first; type <= last && perfect; type++) {
+                const string_view word = TokenTypeValue[type];
+                TokenType &slot = table.slots[hash(word, seed)];
+                if (slot != IDENTIFIER)
+                    perfect = false;
+                slot = (TokenType) type;
+                table.maxLength = std::max(table.maxLength, word.size());
+            }
+
+            if (perfect) {
+                table.seed = seed;
+                return table;
+            }
+        }
+        return Table();
+    }
+
+    constexpr Table table = generate();
+    static_assert(table.seed != maxSeed, "no perfect hash found for keywords, increase tableSize");
+
+    // get type of keyword or IDENTIFIER
+    // (one hash and one compare)
+    constexpr TokenType lookup(string_view word) {
+        if (word.size() > table.maxLength)
+            return IDENTIFIER;
+        const TokenType type = table.slots[hash(word, table.seed)];
+        if (type != IDENTIFIER && word == TokenTypeValue[type])
+            return type;
+        return IDENTIFIER;
+    }
+
+    static_assert(lookup("get") == KEY_GET && lookup("template") == KEY_TEMPLATE 
+        && lookup("f64") == KEY_F64 && lookup("fux") == IDENTIFIER);
+}
\ No newline at end of file
@@ -9,43 +9,84 @@
  * 
  */
 
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+
 #include "lexer.hpp"
 
-Token::Vec Lexer::lex() {
-    while (idx < source.length()) {
+Token::Vec &Lexer::lex() {
+    const size_t amount = chunks();
+    if (amount > 1)
+        lexParallel(amount);
+
+    do tokens.push_back(next());
+    while (tokens.back() != _EOF);
+
+    if (amount > 1) // the chunks were lexed by other lexers
+        matchBrackets();
+    return tokens;
+}
+
+Token Lexer::next() {
+    Token token;
+    while (idx < source.length() && !fuxCancel.cancelled()) {
         getToken();
-        currentToken.end = col - 1;
-        endToken();
-        // update line and column for next token
-        currentToken.start = col;
-        currentToken.line = line; 
+        if (endToken(token)) {
+            matchBracket(token.type);
+            return token;
+        }
     }
 
     currentToken.type = _EOF;
-    currentToken.value = TokenTypeValue[_EOF];
-    currentToken.end = col + 1;
-    endToken();
+    endToken(token);
+    matchBracket(token.type);
+    return token;
+}
 
-    return tokens;
+size_t Lexer::partner(size_t index) const {
+    const auto bracket = std::lower_bound(brackets.begin(), brackets.end(), index, 
+        [](const Bracket &bracket, size_t index) { return bracket.index < index; });
+    if (bracket == brackets.end() || bracket->index != index || bracket->partner == UINT32_MAX)
+        return noPartner;
+    return bracket->partner;
 }
 
-void Lexer::parseLines() {
-    stringstream line;
+void Lexer::forget(size_t index) {
+    while (!brackets.empty() && brackets.front().index < index)
+        brackets.pop_front();
+}
 
-    for (int i = 0; i < source.length(); i++) {
-        if (source[i] == '\n') {
-            lines.push_back(line.str());
-            line.str("");
-        } else
-            line << source[i];
+void Lexer::matchBracket(TokenType type) {
+    const uint32_t index = matched++;
+    if (type < LPAREN || type > RBRACKET)
+        return;
+
+    brackets.push_back({index, UINT32_MAX});
+    vector<uint32_t> &open = unmatched[(type - LPAREN) / 2];
+    if ((type - LPAREN) % 2 == 0)
+        open.push_back(index);
+    else if (!open.empty()) { // a closing bracket without an opening one has no partner
+        brackets.back().partner = open.back();
+        const auto opening = std::lower_bound(brackets.begin(), brackets.end(), open.back(), 
+            [](const Bracket &bracket, size_t index) { return bracket.index < index; });
+        if (opening->index == open.back()) // might be forgotten
+            opening->partner = index;
+        open.pop_back();
     }
+}
 
-    if (!line.str().empty())
-        lines.push_back(line.str());
+void Lexer::matchBrackets() {
+    brackets.clear();
+    matched = 0;
+    for (vector<uint32_t> &open : unmatched)
+        open.clear();
+    for (const Token &token : tokens)
+        matchBracket(token.type);
 }
 
 char Lexer::peek(int offset) {
-    if ((idx + offset - 1) < source.length())
+    if ((idx + offset) < source.length())
         return source[idx+offset];
     return '\0';
 }
@@ -61,466 +102,169 @@ void Lexer::resetPos() {
 }
 
 char Lexer::current() {
-    return source[idx];
+    if (idx < source.length())
+        return source[idx];
+    return '\0'; // the source is not null-terminated
 }
 
 void Lexer::getToken() {
-    currentToken.value = current();
+    switch (current())  {
 
-    switch (currentToken.value.c_str()[0])  {
-
-        case '(': 
-            currentToken.type = LPAREN;
-            advance();
-            break;
-
-        case ')': 
-            currentToken.type = RPAREN;
-            advance();
-            break;
-        
-        case '{': 
-            currentToken.type = LBRACE;
-            advance();
-            break;
-        
-        case '}': 
-            currentToken.type = RBRACE;
-            advance();
-            break;
-        
-        case '[': 
-            if (peek() == ']') {
-                currentToken.type = ARRAY_BRACKET;
-                currentToken.value = "[]";
-                advance(2);
-                break;
-            }
-            
-            currentToken.type = LBRACKET;
-            advance();
-            break;
-
-        case ']': 
-            currentToken.type = RBRACKET;
-            advance();
-            break;
-
-        case ':':
-            if (peek() == ':') {
-                currentToken.type = COLON_COLON;
-                currentToken.value = "::";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = COLON;
-            advance();
-            break;
-        
-        case ';':
-            currentToken.type = SEMICOLON;
-            advance();
-            break;
-        
         case '.':
             if (isdigit(peek())) {
                 currentToken.type = FLOAT;
-                advance(); // advance once, getNumber() will parse digits
-                break;
-            }
-
-            if (peek() == '.' && peek(2) == '.') {
-                currentToken.type = TRIPLE_DOT;
-                currentToken.value = "...";
-                advance(3);
-                break;
+                advance(); // getNumber() expects the first character to be consumed
+                getNumber();
+                getValue();
+                return;
             }
-
-            currentToken.type = DOT;
-            advance();
-            break;
-        
-        case ',':
-            currentToken.type = COMMA;
-            advance();
-            break;
-        
-        case '=':
-            if (peek() == '=') {
-                if (peek(2) == '=') {
-                    currentToken.type = TRIPLE_EQUALS;
-                    currentToken.value = "===";
-                    advance(3);
-                    break;
-                }
-
-                currentToken.type = EQUALS_EQUALS;
-                currentToken.value = "==";
-                advance(2);
-                break;
-            }
-            currentToken.type = EQUALS;
-            advance();
-            break;
-        
-        case '<':
-            if (peek() == '<') {
-                currentToken.type = LSHIFT;
-                currentToken.value = "<<";
-                advance(2);
-                break;
-            }
-
-            if (peek() == '=') {
-                currentToken.type = LTEQUALS;
-                currentToken.value = "<=";
-                advance(2);
-                break;
-            }
-
-            if (peek() == '>') {
-                currentToken.type = SWAP;
-                currentToken.value = "<>";
-                advance(2);
-                break;
-            }
-            
-            if (peek() == '|') {
-                if (peek(2) == '=') {
-                    currentToken.type = LSH_EQUALS;
-                    currentToken.value = "<|=";
-                    advance(3);
-                    break;
-                } 
-
-                currentToken.type = BIT_LSHIFT;
-                currentToken.value = "<|";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = LESSTHAN;
-            advance();
-            break;
-        
-        case '>':
-            if (peek() == '>') {
-                currentToken.type = RSHIFT;
-                currentToken.value = ">>";
-                advance(2);
-                break;
-            }
-
-            if (peek() == '=') {
-                currentToken.type = GTEQUALS;
-                currentToken.value = ">=";
-                advance(2);
-                break;
-            }
-
-            if (peek() == '<') {
-                currentToken.type = BIT_XOR;
-                currentToken.value = "><";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = GREATERTHAN;
-            advance();
-            break;
-
-        case '@':
-            currentToken.type = AT;
-            advance();
-            break;
-        
-        case '!':
-            if (peek() == '=') {
-                currentToken.type = NOT_EQUALS;
-                currentToken.value = "!=";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = EXCLAMATION;
-            advance();
-            break;
-        
-        case '?':
-            currentToken.type = QUESTION;
-            advance();
-            break;
-        
-        case '+':
-            if (peek() == '+') {
-                currentToken.type = PLUS_PLUS;
-                currentToken.value = "++";
-                advance(2);
-                break;
-            }
-
-            if (peek() == '=') {
-                currentToken.type = PLUS_EQUALS;
-                currentToken.value = "+=";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = PLUS;
-            advance();
-            break;
-        
-        case '-':
-            if (peek() == '-') {
-                currentToken.type = MINUS_MINUS;
-                currentToken.value = "--";
-                advance(2);
-                break;
-            }
-
-            if (peek() == '=') {
-                currentToken.type = MINUS_EQUALS;
-                currentToken.value = "-=";
-                advance(2);
-                break;
-            }
-
-            if (peek() == '>') {
-                currentToken.type = POINTER;
-                currentToken.value = "->";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = MINUS;
-            advance();
-            break;
-        
-        case '*':
-            if (peek() == '=') {
-                currentToken.type = ASTERISK_EQUALS;
-                currentToken.value = "*=";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = ASTERISK;
-            advance();
             break;
         
         case '/':
-            if (skipComment())
-                break;
-
-            if (peek() == '=') {
-                currentToken.type = SLASH_EQUALS;
-                currentToken.value = "/=";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = SLASH;
-            advance();
-            break;
-        
-        case '^':
-            if (peek() == '=') {
-                currentToken.type = CARET_EQUALS;
-                currentToken.value = "^=";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = CARET;
-            advance();
-            break;
-        
-        case '%':
-            if (peek() == '=') {
-                currentToken.type = PERCENT_EQUALS;
-                currentToken.value = "%=";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = PERCENT;
-            advance();
-            break;
-
-        case '~':
-            currentToken.type = BIT_NOT;
-            advance();
-            break;
-    
-        case '|':
-            if (peek() == '|') {
-                currentToken.type = OR;
-                currentToken.value = "||";
-                advance(2);
-                break;
-            }
-
-            if (peek() == '=') {
-                currentToken.type = OR_EQUALS;
-                currentToken.value = "|=";
-                advance(2);
-                break;
-            }
-            
-            if (peek() == '>') {
-                if (peek(2) == '=') {
-                    currentToken.type = RSH_EQUALS;
-                    currentToken.value = "|>=";
-                    advance(3);
-                    break;
-                }
-                
-                currentToken.type = BIT_RSHIFT;
-                currentToken.value = "|>";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = BIT_OR;
-            advance();
-            break;
-
-        case '&':
-            if (peek() == '&') {
-                currentToken.type = AND;
-                currentToken.value = "&&";
-                advance(2);
-                break;
-            }
-
-            if (peek() == '=') {
-                currentToken.type = AND_EQUALS;
-                currentToken.value = "&=";
-                advance(2);
-                break;
-            }
-
-            currentToken.type = BIT_AND;
-            advance();
-            break;
-
         case '#':
             if (skipComment())
-                break;
-
-            currentToken.type = HASH;
-            advance();
+                return;
             break;
         
         case ' ':
         case '\t':
         case '\v':
         case '\r':
-            advance();
-            break;
+            advance(fuxScan::whitespaceEnd(here(), end()) - here());
+            return;
         
         case '\n':
             advance();
             resetPos();
-            break;
+            return;
         
         case '0'...'9':
             currentToken.type = NUMBER;
             advance();
             getNumber();
-            break;
+            getValue();
+            return;
         
         case '\'':
             currentToken.type = CHAR;
             advance();
-            currentToken.value = current();
-            if (current() == '\\') { // get escape sequences
+            if (current() == '\\') // get escape sequences
                 advance();
-                currentToken.value.push_back(current());
-            }
             advance();
             if (current() != '\'')
                 error->simpleError(ParseError::ILLEGAL_CHAR_LITERAL_FORMAT, "Expected Ending Quote After Char Literal",
-                    fileName, line, line, currentToken.start, col, "",
+                    fileName, line, line, tokenCol, col, "",
                     col, "Expected a single quote \"'\" here");
             advance();
-            break;
+            // a newline in the literal still starts a new line (columns are taken from the source)
+            for (size_t i = currentToken.offset; i < std::min(idx, source.length()); i++)
+                if (source[i] == '\n') {
+                    ++line;
+                    col = idx - i;
+                }
+            return;
          
         case '"':
             currentToken.type = STRING;
             getString();
-            break;
+            return;
         
         default:
-            if (!isalpha(current()) && currentToken.value != "_") {
-                error->simpleError(ParseError::UNKNOWN_CHARACTER, "Encountered an Unknown Character", fileName, line, line, col, col, "The character '"+currentToken.value+"' is unknown to the lexer");
-                advance();
-            } else {
-                currentToken.type = IDENTIFIER;
-                getIdentifier();
-                checkKeyword();
-            }
             break;
 
     }
+
+    if (getOperator())
+        return;
+
+    if (!isalpha(current()) && current() != '_') {
+        error->simpleError(ParseError::UNKNOWN_CHARACTER, "Encountered an Unknown Character", fileName, line, line, col, col, "The character '"+string(1, current())+"' is unknown to the lexer");
+        advance();
+    } else {
+        currentToken.type = IDENTIFIER;
+        getIdentifier();
+        checkKeyword();
+    }
 }
 
-void Lexer::endToken() {
-    if (currentToken.type != NONE)
-        tokens.push_back(currentToken);
+bool Lexer::getOperator() {
+    TokenType type = NONE;
+    const size_t length = fuxOperators::match(here(), end(), type);
+    if (!length)
+        return false;
+    currentToken.type = type;
+    advance(length);
+    return true;
+}
+
+bool Lexer::endToken(Token &token) {
+    const bool complete = currentToken.type != NONE;
+    if (complete) {
+        currentToken.length = idx - currentToken.offset;
+        token = currentToken;
+    }
     
-    currentToken.type = NONE;
-    currentToken.value.erase();
+    // update position for next token
+    currentToken = Token(NONE, idx, 0, line);
+    tokenCol = col;
+    return complete;
 }
 
 void Lexer::getIdentifier() {
-    bool hasLetter = false;
-    currentToken.value.clear(); // we have to check wether first character is alphabetic
+    const char *first = here();
+    const char *last = fuxScan::identifierEnd(first, end());
+    advance(last - first);
 
-    do {
-        if (isalpha(current()))
-            hasLetter = true;
-        currentToken.value.push_back(current());
-        advance();
-    } while ((isalpha(current()) || isdigit(current()) || current() == '_') && idx < source.length());
+    // we have to check wether first character is alphabetic
+    const bool hasLetter = isalpha(*first) || std::any_of(first, last, [](char c) { return isalpha(c); });
 
     if (!hasLetter)
         error->simpleError(ParseError::GENERIC, "Invalid Identifier Format", fileName, 
             currentToken.line, currentToken.line, 
-            currentToken.start, col, "Expected at least one alphabetic character in identifier");
+            tokenCol, col, "Expected at least one alphabetic character in identifier");
 }
 
 void Lexer::getString() {
-    currentToken.value.clear(); // remove '"'
-    advance();
+    advance(); // skip '"'
 
     if (idx >= source.length())
         error->simpleError(ParseError::ILLEGAL_STRING_LITERAL_FORMAT, "Unterminated String", fileName, 
-            currentToken.line, currentToken.line, currentToken.start, col, "Literal was not terminated before end of file", 
+            currentToken.line, currentToken.line, tokenCol, col, "Literal was not terminated before end of file", 
             col, "Expected a double quote '\"' here");
     
     while (current() != '"') {
+        // skip to the next quote, backslash or newline
+        advance(fuxScan::stringEnd(here(), end()) - here());
+
+        if (idx >= source.length()) {
+            error->simpleError(ParseError::ILLEGAL_STRING_LITERAL_FORMAT, "Unterminated String", fileName, 
+                currentToken.line, currentToken.line, tokenCol, col, "Literal was not terminated before end of file", 
+                col, "Expected a double quote '\"' here");
+            return;
+        }
+
+        if (current() == '"')
+            break;
+
         if (current() == '\n') {
             error->simpleError(ParseError::ILLEGAL_STRING_LITERAL_FORMAT, "Unterminated String", fileName, 
-                currentToken.line, currentToken.line, currentToken.start, col, "Literal was not terminated before end of line",
+                currentToken.line, currentToken.line, tokenCol, col, "Literal was not terminated before end of line",
                 col, "Expected a double quote '\"' here");
             return;
         }
 
         if (current() == '\\' & peek() != '\\' && !isalpha(peek())) {
             error->simpleError(ParseError::ILLEGAL_STRING_LITERAL_FORMAT, "Invalid Escape Sequence found in String Literal",
-                fileName, currentToken.line, currentToken.line, currentToken.start, col, "", 
+                fileName, currentToken.line, currentToken.line, tokenCol, col, "", 
                 col, "Invalid escape sequence found here");
             return;
         }
 
-        currentToken.value.push_back(current());
         advance();
 
         if (idx >= source.length()) {
             error->simpleError(ParseError::ILLEGAL_STRING_LITERAL_FORMAT, "Unterminated String", fileName, 
-                currentToken.line, currentToken.line, currentToken.start, col, "Literal was not terminated before end of file", 
+                currentToken.line, currentToken.line, tokenCol, col, "Literal was not terminated before end of file", 
                 col, "Expected a double quote '\"' here");
             return;
         }
@@ -545,68 +289,52 @@ void Lexer::getNumber() {
     #define ISBIN (current() == '0' || current() == '1')
 
 
-    if (currentToken.value != "0")
+    if (source[currentToken.offset] != '0')
         goto decimal;
 
     if (current() == 'x') {
         currentToken.type = HEXADECIMAL;
-        currentToken.value = "0x";
         advance();
         // extra if for error tracking and not allowing '0x_'
-        if (ISHEX && LENOK) {
-            currentToken.value.push_back(current());
+        if (ISHEX && LENOK)
             advance();
-        } else
+        else
             error->simpleError(ParseError::ILLEGAL_NUMBER_FORMAT, "Expected at least one Digit in Hexadecimal Number", 
-                fileName, currentToken.line, currentToken.line, currentToken.start, col, "Expected at least one digit after '0x'", 
+                fileName, currentToken.line, currentToken.line, tokenCol, col, "Expected at least one digit after '0x'", 
                 col, "Expected at least one digit (0-9, a-f, A-F) here");
         
-        while ((ISHEX || current() == '_') && LENOK) {
-            if (current() != '_')
-                currentToken.value.push_back(current());
+        while ((ISHEX || current() == '_') && LENOK)
             advance();
-        }
 
         return;
     } else if (current() == 'o') {
         currentToken.type = OCTAL;
-        currentToken.value = "0o";
         advance();
 
-        if (ISOCT && LENOK) {
-            currentToken.value.push_back(current());
+        if (ISOCT && LENOK)
             advance();
-        } else
+        else
             error->simpleError(ParseError::ILLEGAL_NUMBER_FORMAT, "Expected at least one Digit in Octal Number", 
-                fileName, currentToken.line, currentToken.line, currentToken.start, col, "Expected at least one digit after '0o'", 
+                fileName, currentToken.line, currentToken.line, tokenCol, col, "Expected at least one digit after '0o'", 
                 col, "Expected at least one digit (0-7) here");
 
-        while ((ISOCT || current() == '_') && LENOK) {
-            if (current() != '_')
-                currentToken.value.push_back(current());
+        while ((ISOCT || current() == '_') && LENOK)
             advance();
-        }
 
         return;
     } else if (current() == 'b') {
         currentToken.type = BINARY;
-        currentToken.value = "0b";
         advance();
 
-        if (ISBIN || current() == '_' && LENOK) {
-            if (current() != '_')
-                currentToken.value.push_back(current());
+        if (ISBIN || current() == '_' && LENOK)
             advance();
-        } else
+        else
             error->simpleError(ParseError::ILLEGAL_NUMBER_FORMAT, "Expected at least one Digit in Binary Number", 
-                fileName, currentToken.line, currentToken.line, currentToken.start, col, "Expected at least one digit after '0o'", 
+                fileName, currentToken.line, currentToken.line, tokenCol, col, "Expected at least one digit after '0o'", 
                 col, "Expected at least one digit (0-1) here");
 
-        while ((ISBIN || current() == '_') && LENOK) {
-            if (current() != '_')
-                currentToken.value.push_back(current());
+        while ((ISBIN || current() == '_') && LENOK)
             advance();
-        }
 
         return;
     }
@@ -617,6 +345,7 @@ void Lexer::getNumber() {
     #define ISEXP (tolower(current()) == 'e' || current() == '+' || current() == '-')
     
     decimal: {
+        char last = source[currentToken.offset]; // last digit without '_'
         bool eFound = false;
         bool signFound = false;
         
@@ -627,7 +356,7 @@ void Lexer::getNumber() {
             } else if (current() == 'e') {
                 if (eFound) {
                     error->simpleError(ParseError::ILLEGAL_NUMBER_FORMAT, "Unexpected Character in Decimal Integer", 
-                        fileName, currentToken.line, currentToken.line, currentToken.start, col, "Unexpected 'e' in decimal integer",
+                        fileName, currentToken.line, currentToken.line, tokenCol, col, "Unexpected 'e' in decimal integer",
                         col, "'e' was found here");
                     advance();
                     return;
@@ -636,7 +365,7 @@ void Lexer::getNumber() {
             } else if (current() == '+' || current() == '-') {
                 if (signFound) {
                     error->simpleError(ParseError::ILLEGAL_NUMBER_FORMAT, "Unexpected Character in Decimal Integer", 
-                        fileName, currentToken.line, currentToken.line, currentToken.start, col, "Unexpected '"+string(1, current())+"' in decimal integer",
+                        fileName, currentToken.line, currentToken.line, tokenCol, col, "Unexpected '"+string(1, current())+"' in decimal integer",
                         col, "'"+string(1, current())+"' was found here");
                     advance();
                     return;
@@ -648,18 +377,18 @@ void Lexer::getNumber() {
                 signFound = true;
             }
 
-            currentToken.value.push_back(current());
+            last = current();
             advance();
         } 
     
-        if (eFound && (currentToken.value.back() == 'e'
-        || currentToken.value.back() == 'E'
-        || currentToken.value.back() == '+'
-        || currentToken.value.back() == '-')) {
+        if (eFound && (last == 'e'
+        || last == 'E'
+        || last == '+'
+        || last == '-')) {
             error->simpleError(ParseError::ILLEGAL_NUMBER_FORMAT, "Unexpected Character in Decimal Integer", 
-                        fileName, currentToken.line, currentToken.line, currentToken.start, col, 
-                        "Expected at least on digit (0-9) after '"+string(1, currentToken.value.back()),
-                        col-1, "'"+string(1, currentToken.value.back())+"' was found here");             
+                        fileName, currentToken.line, currentToken.line, tokenCol, col, 
+                        "Expected at least on digit (0-9) after '"+string(1, last),
+                        col-1, "'"+string(1, last)+"' was found here");             
             return;
         }
         
@@ -672,6 +401,7 @@ void Lexer::getNumber() {
     floating: {
         currentToken.type = FLOAT;
 
+        char last = '.';
         bool eFound = false;
         bool signFound = false;
 
@@ -682,7 +412,7 @@ void Lexer::getNumber() {
             } else if (current() == 'e') {
                 if (eFound) {
                     error->simpleError(ParseError::ILLEGAL_NUMBER_FORMAT, "Unexpected Character in Flaoting Point Integer", 
-                        fileName, currentToken.line, currentToken.line, currentToken.start, col, "Unexpected 'e' in float",
+                        fileName, currentToken.line, currentToken.line, tokenCol, col, "Unexpected 'e' in float",
                         col, "'e' was found here");            
                     advance();
                     return;
@@ -691,7 +421,7 @@ void Lexer::getNumber() {
             } else if (current() == '+' || current() == '-') {
                 if (signFound) {
                     error->simpleError(ParseError::ILLEGAL_NUMBER_FORMAT, "Unexpected Character in Flaoting Point Integer", 
-                        fileName, currentToken.line, currentToken.line, currentToken.start, col, 
+                        fileName, currentToken.line, currentToken.line, tokenCol, col, 
                         "Unexpected '"+string(1, current())+"' in float",
                         col, "'"+string(1, current())+"' was found here");
                     advance();
@@ -704,18 +434,18 @@ void Lexer::getNumber() {
                 signFound = true;
             }
 
-            currentToken.value.push_back(current());
+            last = current();
             advance();
         } while ((isdigit(current()) || ISEXP || current() == '_') && LENOK);
             
-        if (eFound && (currentToken.value.back() == 'e'
-        || currentToken.value.back() == 'E'
-        || currentToken.value.back() == '+'
-        || currentToken.value.back() == '-')) {
+        if (eFound && (last == 'e'
+        || last == 'E'
+        || last == '+'
+        || last == '-')) {
             error->simpleError(ParseError::ILLEGAL_NUMBER_FORMAT, "Unexpected Character in Floating Point Integer", 
-                        fileName, currentToken.line, currentToken.line, currentToken.start, col, 
-                        "Expected at least on digit (0-9) after '"+string(1, currentToken.value.back()),
-                        col-1, "'"+string(1, currentToken.value.back())+"' was found here");               
+                        fileName, currentToken.line, currentToken.line, tokenCol, col, 
+                        "Expected at least on digit (0-9) after '"+string(1, last),
+                        col-1, "'"+string(1, last)+"' was found here");               
             return;
         }
     }
@@ -724,22 +454,112 @@ void Lexer::getNumber() {
     #undef LENOK
 }
 
+void Lexer::getValue() {
+    uint64_t value = 0;
+    if (!evaluate(currentToken.type, source.data() + currentToken.offset, source.data() + std::min(idx, source.length()), value))
+        error->simpleError(ParseError::ILLEGAL_NUMBER_FORMAT, "Number too large", 
+            fileName, currentToken.line, currentToken.line, tokenCol, col - 1, "", 
+            tokenCol, "Number does not fit into 64 bits");
+    currentToken.payload = storeNumber(currentToken.type, value);
+}
+
+bool Lexer::evaluate(TokenType type, const char *it, const char *end, uint64_t &value) {
+    string stripped; // without '_'
+    if (memchr(it, '_', end - it)) {
+        std::copy_if(it, end, std::back_inserter(stripped), [](char c) { return c != '_'; });
+        it = stripped.data();
+        end = it + stripped.length();
+    }
+
+    value = 0;
+    switch (type) {
+        case HEXADECIMAL:
+        case OCTAL:
+        case BINARY: {
+            const size_t shift = type == HEXADECIMAL ? 4 : type == OCTAL ? 3 : 1;
+            bool fits = true;
+            for (it += 2; it < end; ++it) { // skip "0x", "0o" or "0b"
+                fits &= (value >> (64 - shift)) == 0;
+                value = (value << shift) | (isdigit(*it) ? *it - '0' : tolower(*it) - 'a' + 10);
+            }
+            return fits;
+        }
+
+        case FLOAT: { // std::from_chars for double is missing in older libc++
+            const string text = string(it, end); // the source is not null-terminated
+            errno = 0;
+            const double floating = strtod(text.c_str(), nullptr);
+            value = std::bit_cast<uint64_t>(floating);
+            return errno != ERANGE || (floating != 0 && floating != HUGE_VAL); // subnormals fit
+        }
+
+        default: { // decimal, maybe with an exponent
+            const std::from_chars_result result = std::from_chars(it, end, value);
+            if (result.ec == std::errc::result_out_of_range)
+                return false;
+            if (result.ptr + 1 >= end || tolower(*result.ptr) != 'e')
+                return true;
+
+            const bool negative = result.ptr[1] == '-';
+            size_t exponent = 0;
+            std::from_chars(result.ptr + 1 + (result.ptr[1] == '+' || negative), end, exponent);
+            for (; exponent && value; --exponent) {
+                if (negative)
+                    value /= 10;
+                else if (value > UINT64_MAX / 10)
+                    return false;
+                else
+                    value *= 10;
+            }
+            return true;
+        }
+    }
+}
+
+uint32_t Lexer::storeNumber(TokenType type, uint64_t value) {
+    if (type != FLOAT && value < storedNumber)
+        return value;
+    numbers.push_back(value);
+    return storedNumber | (numbers.size() - 1);
+}
+
+void Lexer::adoptNumber(Token &token) {
+    if (!token.isNumber() || !(token.payload & storedNumber))
+        return;
+    uint64_t value = 0;
+    evaluate(token.type, source.data() + token.offset, source.data() + token.offset + token.length, value);
+    token.payload = storeNumber(token.type, value);
+}
+
+uint64_t Lexer::number(const Token &token) const {
+    assert(token.isNumber() && "token is not a number");
+    if (token.payload & storedNumber)
+        return numbers[token.payload & ~storedNumber];
+    return token.payload;
+}
+
 bool Lexer::skipComment() {
-    if (current() == '#' && peek() == '!') { // ignore '#!...'
-        do advance(); while (idx < source.length() && peek(-1) != '\n'); // peek(-1) so '\n' gets skipped
-        resetPos();
-        return true;
-    } else if (peek() == '/') { // single line comment '// ...'
-        do advance(); while (idx < source.length() && peek(-1) != '\n'); // peek(-1) so '\n' gets skipped
+    if ((current() == '#' && peek() == '!') // ignore '#!...'
+    || peek() == '/') { // single line comment '// ...'
+        const char *newline = fuxScan::lineEnd(here(), end());
+        if (newline == end()) { // last line of the file, there is no next one
+            col += newline - here();
+            idx = source.length();
+            return true;
+        }
+        idx = newline - source.data() + 1; // skip the '\n' too
         resetPos();
         return true;
     } else if (peek() == '*') { // multi line comment '/* ... */'
-                                                // check for  '*/'
-        while (idx < source.length() && (current() != '*' || peek() != '/')) {
-            advance();
-            if (peek(-1) == '\n') 
-                resetPos();
-        }
+        size_t lines = 0;
+        const char *lastNewline = nullptr;
+        const char *close = fuxScan::commentEnd(here(), end(), lines, lastNewline); // check for  '*/'
+        if (lines) {
+            line += lines;
+            col = close - lastNewline;
+        } else
+            col += close - here();
+        idx = close - source.data();
         
         if (idx >= source.length())
             error->simpleError(ParseError::UNEXPECTED_EOF, "Expected Multi-Line Comment to end", 
@@ -754,8 +574,8 @@ bool Lexer::skipComment() {
 }
 
 void Lexer::checkKeyword() { 
-    auto it = find(TokenTypeValue.begin(), TokenTypeValue.end(), currentToken.value);
-  
-    if (it != TokenTypeValue.end())
-        currentToken.type = (TokenType) (it - TokenTypeValue.begin());
+    const string_view value = source.substr(currentToken.offset, idx - currentToken.offset);
+    currentToken.type = fuxKeywords::lookup(value);
+    if (currentToken.type == IDENTIFIER)
+        currentToken.payload = fuxSymbols.intern(value);
 }
\ No newline at end of file
@@ -12,43 +12,93 @@
 
 #pragma once
 
+#include <deque>
+
 #include "../../fux.hpp"
 #include "token.hpp"
+#include "keywords.hpp"
+#include "operators.hpp"
+#include "scan.hpp"
 #include "../error/error.hpp"
+#include "../../util/buffer.hpp"
+#include "../../util/symbols.hpp"
 
 class Lexer {
 public:
-    Lexer(const string source, const string &fileName, ErrorManager *error) 
-    : fileName(fileName), source(source), tokens({}), currentToken(Token()), 
-        idx(0), col(1), line(1), error(error) {
-            parseLines();
-            error->addSourceFile(fileName, lines);
+    Lexer(const SourceBuffer *buffer, const string &fileName, ErrorManager *error) 
+    : fileName(fileName), buffer(buffer), source(buffer->view()), tokens({}), currentToken(Token()), 
+        idx(0), col(1), line(1), tokenCol(1), error(error) {
+            error->addSourceFile(fileName, buffer);
     }
 
     ~Lexer() {
         tokens.clear();
-        lines.clear();
-        source.clear();
     }
 
-    // lex source
-    Token::Vec lex();
+    // lex whole source (in parallel for large files)
+    Token::Vec &lex();
+    // lex next token (_EOF at the end)
+    Token next();
+
+    // amount of chunks lex() splits the source into (1: serial)
+    size_t chunks();
+    // chunks should not be smaller than this (tests lower it)
+    static size_t minChunkSize;
+
+    // update the tokens of the previous source after an edit:
+    // [offset, offset + removed) of the previous source was replaced by inserted,
+    // this lexer's buffer has to be the edited source (see SourceBuffer::edit());
+    // only lexes from the last token the edit can't have changed
+    // until the tokens are the same as before again
+    Token::Vec &relex(const Token::Vec &previous, size_t offset, size_t removed, string_view inserted);
+
+    // value of a numeric literal token (bits of the double for FLOAT)
+    uint64_t number(const Token &token) const;
+
+    // index of the bracket matching the token at index (in the order next() returned them)
+    // or noPartner if there is none (yet): ( ), [ ] and { } are matched separately
+    static constexpr size_t noPartner = SIZE_MAX;
+    size_t partner(size_t index) const;
+    // drop the partners of the brackets before index
+    // (a stream that doesn't keep those tokens anymore)
+    void forget(size_t index);
 
-    vector<string> getLines() { return this->lines; }
+    const SourceBuffer *getBuffer() { return this->buffer; }
+    string_view getSource() { return this->source; }
 
     void debugPrint();
 
 private:
+    // start of a chunk for parallel lexing
+    struct Chunk {
+        size_t offset;
+        size_t line;
+    };
+
+    struct Bracket {
+        uint32_t index;     // of the token
+        uint32_t partner;   // UINT32_MAX if there is none (yet)
+    };
+
+    // how far the lexer may read past the end of a token
+    static constexpr size_t lookahead = fuxOperators::maxLength;
+    // integers below this are stored in the token's payload,
+    // larger ones and floats in numbers (the payload is their index with this bit set)
+    static constexpr uint32_t storedNumber = 1u << 31;
+
     const string &fileName;
-    string source;
-    vector<string> lines;
+    const SourceBuffer *buffer;
+    string_view source;
     Token::Vec tokens;
     Token currentToken;
     size_t idx, col, line;
+    size_t tokenCol; // column of currentToken
+    vector<uint64_t> numbers;
+    std::deque<Bracket> brackets;   // see partner(), only the bracket tokens in order
+    size_t matched = 0;             // amount of tokens passed to matchBracket()
+    vector<uint32_t> unmatched[3];  // indices of open ( [ {
     ErrorManager *error;
 
-    // split source into vector of lines
-    void parseLines();
     // peek to next chararacter
     char peek(int offset = 1);
     // advance to next character
@@ -57,19 +107,47 @@ private:
     void resetPos();
     // get current character
     char current();
+    // pointer to current character
+    const char *here() { return source.data() + idx; }
+    // pointer behind the last character
+    const char *end() { return source.data() + source.length(); }
     // get next token
     void getToken();
-    // reset currenToken and push to tokens
-    void endToken();
+    // get longest operator (false if there is none)
+    bool getOperator();
+    // reset currentToken and write it to token if complete
+    bool endToken(Token &token);
     // get identifier
     void getIdentifier();
     // get string
     void getString();
     // get number
     void getNumber();
+    // compute the value of the number in currentToken
+    void getValue();
+    // compute the value of a numeric literal of type in [it, end)
+    // (false if it does not fit into 64 bits)
+    static bool evaluate(TokenType type, const char *it, const char *end, uint64_t &value);
+    // get the payload for a value, storing it in numbers if needed
+    uint32_t storeNumber(TokenType type, uint64_t value);
+    // store the value of a number lexed by another lexer
+    void adoptNumber(Token &token);
     // skip comments
     bool skipComment();
     // check identifiers for keywords
     void checkKeyword();
+    // add the next token to brackets if it is one
+    void matchBracket(TokenType type);
+    // recompute brackets for tokens
+    void matchBrackets();
+
+    // continue lexing at offset
+    void seek(size_t offset, size_t line, size_t col = 1);
+    // lex until a token ends at or after stop and collect the tokens
+    void lexUntil(size_t stop);
+    // find newlines outside of comments and literals to split the source at
+    vector<Chunk> findChunks(size_t amount);
+    // lex chunks on worker threads and stitch them together
+    void lexParallel(size_t amount);
 
 };
\ No newline at end of file
@@ -0,0 +1,88 @@
+/**
+ * @file operators.hpp
+ * @author fuechs
+ * @brief fux operator lexing header
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ * 
+ */
+
+#pragma once
+
+#include "../../fux.hpp"
+#include "token.hpp"
+
+// maximal munch dfa for all operators and punctuation (LPAREN ... ARRAY_BRACKET),
+// generated at compile time from their spelling in TokenTypeValue;
+// a new operator only needs a TokenType and a spelling
+namespace fuxOperators {
+
+    constexpr size_t first = LPAREN;
+    constexpr size_t last = ARRAY_BRACKET;
+    constexpr size_t maxStates = 128;
+    constexpr size_t maxClasses = 32;
+
+    struct Table {
+        uint8_t classes[256] = {};                  // character -> class (0: no operator character)
+        uint8_t next[maxStates][maxClasses] = {};   // state, class -> state (0: no transition)
+        TokenType accept[maxStates] = {};           // token of state or NONE
+        size_t states = 1;                          // 0 is the start state
+        size_t classCount = 1;
+    };
+
+    // build a trie of all spellings
+    constexpr Table generate() {
+        Table table;
+        for (TokenType &type : table.accept)
+            type = NONE;
+
+        for (size_t type = first; type <= last; type++) {
+            size_t state = 0;
+            for (const char *c = TokenTypeValue[type]; *c; c++) {
+                uint8_t &cls = table.classes[(uint8_t) *c];
+                if (!cls)
+                    cls = table.classCount++;
+                uint8_t &next = table.next[state][cls];
+                if (!next)
+                    next = table.states++;
+                state = next;
+            }
+            table.accept[state] = (TokenType) type;
+        }
+
+        return table;
+    }
+
+    // longest spelling
+    constexpr size_t longest() {
+        size_t length = 0;
+        for (size_t type = first; type <= last; type++)
+            length = std::max(length, std::char_traits<char>::length(TokenTypeValue[type]));
+        return length;
+    }
+
+    constexpr Table table = generate();
+    constexpr size_t maxLength = longest();
+    static_assert(table.states <= maxStates && table.classCount <= maxClasses, "operator table is too small");
+
+    // get longest operator at it (0 if there is none)
+    // and write its token type into type
+    constexpr size_t match(const char *it, const char *end, TokenType &type) {
+        size_t state = 0;
+        size_t length = 0;
+
+        for (const char *c = it; c < end; c++) {
+            state = table.next[state][table.classes[(uint8_t) *c]];
+            if (!state)
+                break;
+            if (table.accept[state] != NONE) {
+                type = table.accept[state];
+                length = c - it + 1;
+            }
+        }
+
+        return length;
+    }
+}
\ No newline at end of file
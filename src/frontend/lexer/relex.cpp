@@ -0,0 +1,75 @@
+/**
+ * @file relex.cpp
+ * @author fuechs
+ * @brief fux incremental lexing
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "lexer.hpp"
+
+Token::Vec &Lexer::relex(const Token::Vec &previous, size_t offset, size_t removed, string_view inserted) {
+    assert(!previous.empty() && previous.back() == _EOF && "previous tokens are incomplete");
+    assert(source.substr(offset, inserted.length()) == inserted && "buffer does not contain the edit");
+
+    const int64_t delta = (int64_t) inserted.length() - (int64_t) removed;
+    const size_t editEnd = offset + inserted.length(); // in the edited source
+    
+    // a token that ends (plus lookahead) before the edit is lexed exactly like before,
+    // so the lexer can restart at the last one of them
+    const auto changed = std::partition_point(previous.begin(), previous.end() - 1, 
+        [&](const Token &token) { return token.offset + token.length + lookahead <= offset; });
+    const size_t restart = changed == previous.begin() ? 0 : changed - previous.begin() - 1;
+
+    tokens.assign(previous.begin(), previous.begin() + restart);
+    for (Token &token : tokens)
+        adoptNumber(token);
+    if (changed == previous.begin())
+        seek(0, 1);
+    else
+        seek(previous[restart].offset, previous[restart].line, previous[restart].column(*buffer));
+
+    // the old tokens after the edit, in the order they could match again
+    size_t old = restart;
+    while (previous[old] != _EOF && previous[old].offset < offset + removed)
+        ++old;
+
+    for (;;) {
+        Token token = next();
+        if (token == _EOF) {
+            tokens.push_back(token);
+            matchBrackets();
+            return tokens;
+        }
+
+        if (token.offset < editEnd) {
+            tokens.push_back(token);
+            continue;
+        }
+        
+        while (previous[old] != _EOF && (int64_t) previous[old].offset + delta < token.offset)
+            ++old;
+
+        // same token after the edit: 
+        // the rest of the source is unchanged, so are the remaining tokens
+        const Token &match = previous[old];
+        if ((int64_t) match.offset + delta == token.offset && match.type == token.type 
+        && match.length == token.length) {
+            const int64_t lines = (int64_t) token.line - (int64_t) match.line;
+            for (size_t i = old; i < previous.size(); i++) {
+                Token shifted = previous[i];
+                shifted.offset += delta;
+                shifted.line += lines;
+                adoptNumber(shifted);
+                tokens.push_back(shifted);
+            }
+            matchBrackets();
+            return tokens;
+        }
+
+        tokens.push_back(token);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,236 @@
+/**
+ * @file scan.cpp
+ * @author fuechs
+ * @brief fux source scanning kernels
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "scan.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    #define FUX_SCAN_X86
+    #include <immintrin.h>
+#endif
+
+namespace fuxScan {
+
+    namespace scalar {
+
+        inline bool isIdentifier(char c) {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        }
+
+        const char *identifierEnd(const char *it, const char *end) {
+            while (it < end && isIdentifier(*it))
+                ++it;
+            return it;
+        }
+
+        const char *whitespaceEnd(const char *it, const char *end) {
+            while (it < end && (*it == ' ' || *it == '\t' || *it == '\v' || *it == '\r'))
+                ++it;
+            return it;
+        }
+
+        const char *lineEnd(const char *it, const char *end) {
+            while (it < end && *it != '\n')
+                ++it;
+            return it;
+        }
+
+        const char *stringEnd(const char *it, const char *end) {
+            while (it < end && *it != '"' && *it != '\\' && *it != '\n')
+                ++it;
+            return it;
+        }
+
+        const char *commentEnd(const char *it, const char *end, size_t &lines, const char *&lastNewline) {
+            for (; it < end; ++it) {
+                if (*it == '*' && it + 1 < end && it[1] == '/')
+                    return it;
+                if (*it == '\n') {
+                    ++lines;
+                    lastNewline = it;
+                }
+            }
+            return end;
+        }
+    }
+
+    #ifdef FUX_SCAN_X86
+
+    // 16 bytes at a time; sse2 is available on every x86-64 cpu
+    namespace sse2 {
+
+        inline __m128i load(const char *it) { return _mm_loadu_si128((const __m128i *) it); }
+
+        inline __m128i eq(__m128i v, char c) { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); }
+
+        // lo <= v <= hi (signed, so bytes >= 0x80 never match)
+        inline __m128i range(__m128i v, char lo, char hi) {
+            return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)), _mm_cmpgt_epi8(_mm_set1_epi8(hi + 1), v));
+        }
+
+        inline uint32_t mask(__m128i v) { return (uint32_t) _mm_movemask_epi8(v); }
+
+        const char *identifierEnd(const char *it, const char *end) {
+            for (; end - it >= 16; it += 16) {
+                const __m128i v = load(it);
+                const __m128i letter = range(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z');
+                const __m128i word = _mm_or_si128(_mm_or_si128(letter, range(v, '0', '9')), eq(v, '_'));
+                if (const uint32_t stop = ~mask(word) & 0xFFFF)
+                    return it + __builtin_ctz(stop);
+            }
+            return scalar::identifierEnd(it, end);
+        }
+
+        const char *whitespaceEnd(const char *it, const char *end) {
+            for (; end - it >= 16; it += 16) {
+                const __m128i v = load(it);
+                const __m128i space = _mm_or_si128(_mm_or_si128(eq(v, ' '), eq(v, '\t')), _mm_or_si128(eq(v, '\v'), eq(v, '\r')));
+                if (const uint32_t stop = ~mask(space) & 0xFFFF)
+                    return it + __builtin_ctz(stop);
+            }
+            return scalar::whitespaceEnd(it, end);
+        }
+
+        const char *lineEnd(const char *it, const char *end) {
+            for (; end - it >= 16; it += 16)
+                if (const uint32_t stop = mask(eq(load(it), '\n')))
+                    return it + __builtin_ctz(stop);
+            return scalar::lineEnd(it, end);
+        }
+
+        const char *stringEnd(const char *it, const char *end) {
+            for (; end - it >= 16; it += 16) {
+                const __m128i v = load(it);
+                if (const uint32_t stop = mask(_mm_or_si128(_mm_or_si128(eq(v, '"'), eq(v, '\\')), eq(v, '\n'))))
+                    return it + __builtin_ctz(stop);
+            }
+            return scalar::stringEnd(it, end);
+        }
+
+        const char *commentEnd(const char *it, const char *end, size_t &lines, const char *&lastNewline) {
+            for (; end - it > 16; it += 16) { // '/' is read from the next byte
+                const __m128i v = load(it);
+                uint32_t newlines = mask(eq(v, '\n'));
+                const uint32_t stop = mask(_mm_and_si128(eq(v, '*'), eq(load(it + 1), '/')));
+                if (stop)
+                    newlines &= (1u << __builtin_ctz(stop)) - 1;
+                if (newlines) {
+                    lines += __builtin_popcount(newlines);
+                    lastNewline = it + 31 - __builtin_clz(newlines);
+                }
+                if (stop)
+                    return it + __builtin_ctz(stop);
+            }
+            return scalar::commentEnd(it, end, lines, lastNewline);
+        }
+    }
+
+    // 32 bytes at a time
+    namespace avx2 {
+
+        __attribute__((target("avx2")))
+        inline __m256i load(const char *it) { return _mm256_loadu_si256((const __m256i *) it); }
+
+        __attribute__((target("avx2")))
+        inline __m256i eq(__m256i v, char c) { return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c)); }
+
+        __attribute__((target("avx2")))
+        inline __m256i range(__m256i v, char lo, char hi) {
+            return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(lo - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8(hi + 1), v));
+        }
+
+        __attribute__((target("avx2")))
+        inline uint32_t mask(__m256i v) { return (uint32_t) _mm256_movemask_epi8(v); }
+
+        __attribute__((target("avx2")))
+        const char *identifierEnd(const char *it, const char *end) {
+            for (; end - it >= 32; it += 32) {
+                const __m256i v = load(it);
+                const __m256i letter = range(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z');
+                const __m256i word = _mm256_or_si256(_mm256_or_si256(letter, range(v, '0', '9')), eq(v, '_'));
+                if (const uint32_t stop = ~mask(word))
+                    return it + __builtin_ctz(stop);
+            }
+            return sse2::identifierEnd(it, end);
+        }
+
+        __attribute__((target("avx2")))
+        const char *whitespaceEnd(const char *it, const char *end) {
+            for (; end - it >= 32; it += 32) {
+                const __m256i v = load(it);
+                const __m256i space = _mm256_or_si256(_mm256_or_si256(eq(v, ' '), eq(v, '\t')), _mm256_or_si256(eq(v, '\v'), eq(v, '\r')));
+                if (const uint32_t stop = ~mask(space))
+                    return it + __builtin_ctz(stop);
+            }
+            return sse2::whitespaceEnd(it, end);
+        }
+
+        __attribute__((target("avx2")))
+        const char *lineEnd(const char *it, const char *end) {
+            for (; end - it >= 32; it += 32)
+                if (const uint32_t stop = mask(eq(load(it), '\n')))
+                    return it + __builtin_ctz(stop);
+            return sse2::lineEnd(it, end);
+        }
+
+        __attribute__((target("avx2")))
+        const char *stringEnd(const char *it, const char *end) {
+            for (; end - it >= 32; it += 32) {
+                const __m256i v = load(it);
+                if (const uint32_t stop = mask(_mm256_or_si256(_mm256_or_si256(eq(v, '"'), eq(v, '\\')), eq(v, '\n'))))
+                    return it + __builtin_ctz(stop);
+            }
+            return sse2::stringEnd(it, end);
+        }
+
+        __attribute__((target("avx2")))
+        const char *commentEnd(const char *it, const char *end, size_t &lines, const char *&lastNewline) {
+            for (; end - it > 32; it += 32) { // '/' is read from the next byte
+                const __m256i v = load(it);
+                uint32_t newlines = mask(eq(v, '\n'));
+                const uint32_t stop = mask(_mm256_and_si256(eq(v, '*'), eq(load(it + 1), '/')));
+                if (stop)
+                    newlines &= (1u << __builtin_ctz(stop)) - 1;
+                if (newlines) {
+                    lines += __builtin_popcount(newlines);
+                    lastNewline = it + 31 - __builtin_clz(newlines);
+                }
+                if (stop)
+                    return it + __builtin_ctz(stop);
+            }
+            return sse2::commentEnd(it, end, lines, lastNewline);
+        }
+    }
+
+    #endif
+
+    const Kernels scalarKernels = {
+        "scalar", scalar::identifierEnd, scalar::whitespaceEnd, scalar::lineEnd, scalar::stringEnd, scalar::commentEnd};
+
+    #ifdef FUX_SCAN_X86
+    const Kernels sse2Kernels = {
+        "sse2", sse2::identifierEnd, sse2::whitespaceEnd, sse2::lineEnd, sse2::stringEnd, sse2::commentEnd};
+    const Kernels avx2Kernels = {
+        "avx2", avx2::identifierEnd, avx2::whitespaceEnd, avx2::lineEnd, avx2::stringEnd, avx2::commentEnd};
+    #endif
+
+    const Kernels &select() {
+        #ifdef FUX_SCAN_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return avx2Kernels;
+        return sse2Kernels;
+        #else
+        return scalarKernels;
+        #endif
+    }
+
+    const Kernels &kernels = select();
+}
\ No newline at end of file
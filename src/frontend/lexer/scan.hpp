@@ -0,0 +1,47 @@
+/**
+ * @file scan.hpp
+ * @author fuechs
+ * @brief fux source scanning kernels header
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#pragma once
+
+#include "../../fux.hpp"
+
+// vectorized scanning of long character runs for the lexer;
+// the fastest implementation (avx2, sse2 or scalar) is picked at runtime.
+// every kernel scans [it, end) and returns a pointer to the first character
+// that ends the run, or end if there is none
+namespace fuxScan {
+
+    struct Kernels {
+        const char *name;
+        // first character that is not [a-zA-Z0-9_]
+        const char *(*identifierEnd)(const char *it, const char *end);
+        // first character that is not ' ', '\t', '\v' or '\r'
+        const char *(*whitespaceEnd)(const char *it, const char *end);
+        // first '\n'
+        const char *(*lineEnd)(const char *it, const char *end);
+        // first '"', '\\' or '\n'
+        const char *(*stringEnd)(const char *it, const char *end);
+        // first '*' followed by '/';
+        // counts the newlines before it and remembers the last one
+        const char *(*commentEnd)(const char *it, const char *end, size_t &lines, const char *&lastNewline);
+    };
+
+    // kernels selected for this cpu
+    extern const Kernels &kernels;
+
+    inline const char *identifierEnd(const char *it, const char *end) { return kernels.identifierEnd(it, end); }
+    inline const char *whitespaceEnd(const char *it, const char *end) { return kernels.whitespaceEnd(it, end); }
+    inline const char *lineEnd(const char *it, const char *end) { return kernels.lineEnd(it, end); }
+    inline const char *stringEnd(const char *it, const char *end) { return kernels.stringEnd(it, end); }
+    inline const char *commentEnd(const char *it, const char *end, size_t &lines, const char *&lastNewline) {
+        return kernels.commentEnd(it, end, lines, lastNewline);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+/**
+ * @file stream.cpp
+ * @author fuechs
+ * @brief fux token stream
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ * 
+ */
+
+#include "stream.hpp"
+
+TokenStream::TokenStream(Lexer *lexer, size_t capacity)
+: lexer(lexer), ring(Token::Vec(capacity)), pins({}), current(0), lexed(0), none(Token()), tokens(nullptr), 
+    limit(SIZE_MAX), end(Token()) {
+    assert((capacity & (capacity - 1)) == 0 && "capacity has to be a power of two");
+}
+
+TokenStream::TokenStream(const TokenStream &stream, size_t begin, size_t end)
+: lexer(stream.lexer), ring({}), pins({}), current(begin), lexed(0), none(Token()), tokens(stream.tokens), 
+    limit(end), end(Token()) {
+    assert(tokens && end < tokens->size() && "only materialized streams can be split");
+    const Token &next = (*tokens)[end];
+    this->end = Token(_EOF, next.offset, 0, next.line);
+}
+
+TokenStream::~TokenStream() {
+    ring.clear();
+    pins.clear();
+}
+
+TokenStream::Checkpoint::Checkpoint(TokenStream &stream) 
+: stream(stream), position(stream.current), active(true) {
+    stream.pins.push_back(position);
+}
+
+TokenStream::Checkpoint::~Checkpoint() { release(); }
+
+void TokenStream::Checkpoint::rewind() {
+    assert(active && "rewind to released checkpoint");
+    stream.current = position;
+}
+
+void TokenStream::Checkpoint::release() {
+    if (!active)
+        return;
+    active = false;
+    // checkpoints are nested, so this is usually the last pin
+    auto it = std::find(stream.pins.rbegin(), stream.pins.rend(), position);
+    stream.pins.erase(std::next(it).base());
+}
+
+Token TokenStream::Checkpoint::token() { return stream.at(position); }
+
+Token TokenStream::operator*() { return at(current); }
+
+const Token *TokenStream::operator->() { 
+    at(current);
+    if (tokens)
+        return current < limit ? &(*tokens)[std::min(current, tokens->size() - 1)] : &end;
+    return current < limit ? &ring[current & (ring.size() - 1)] : &end;
+}
+
+Token TokenStream::peek(int64_t steps) {
+    if (steps < 0 && (size_t) -steps > current)
+        return none;
+    return at(current + steps);
+}
+
+TokenStream &TokenStream::operator++() {
+    ++current;
+    return *this;
+}
+
+TokenStream &TokenStream::operator+=(size_t steps) {
+    current += steps;
+    return *this;
+}
+
+size_t TokenStream::position() const { return current; }
+
+size_t TokenStream::partner() {
+    if (tokens) {
+        const size_t index = lexer->partner(current);
+        return index != Lexer::noPartner ? std::min(index, limit) : std::min(tokens->size() - 1, limit);
+    }
+
+    at(current);
+    for (;;) {
+        const size_t index = lexer->partner(current);
+        if (index != Lexer::noPartner)
+            return index;
+        if (lexed > limit)
+            return limit;
+        at(lexed);
+    }
+}
+
+void TokenStream::materialize() {
+    assert(lexed == 0 && "tokens were already lexed on demand");
+    tokens = &lexer->lex();
+    lexer->debugPrint();
+}
+
+Token TokenStream::at(size_t index) {
+    if (tokens) // the last token is _EOF
+        return index < limit ? (*tokens)[std::min(index, tokens->size() - 1)] : end;
+    if (index >= limit)
+        return end;
+
+    assert(index >= oldest() && "token was already dropped from the stream");
+
+    lexer->forget(oldest());
+    while (lexed <= index) {
+        if (lexed - oldest() >= ring.size())
+            grow();
+        Token &token = ring[lexed & (ring.size() - 1)];
+        token = lexer->next();
+        debugPrint(token);
+        if (token == _EOF) { // the lexer is done, don't ask it again
+            limit = lexed;
+            end = token;
+            ++lexed;
+            return end;
+        }
+        ++lexed;
+    }
+
+    return ring[index & (ring.size() - 1)];
+}
+
+size_t TokenStream::oldest() const {
+    size_t index = current ? current - 1 : 0; // keep the previous token for peek(-1)
+    for (const size_t &pin : pins)
+        index = std::min(index, pin);
+    return std::min(index, lexed);
+}
+
+void TokenStream::grow() {
+    Token::Vec larger = Token::Vec(ring.size() * 2);
+    for (size_t i = oldest(); i < lexed; i++)
+        larger[i & (larger.size() - 1)] = ring[i & (ring.size() - 1)];
+    ring.swap(larger);
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+/**
+ * @file stream.hpp
+ * @author fuechs
+ * @brief fux token stream header
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ * 
+ */
+
+#pragma once
+
+#include "../../fux.hpp"
+#include "lexer.hpp"
+
+// pull based token source for the parser;
+// tokens are lexed on demand into a ring buffer, which only keeps 
+// the previous token, the lookahead and everything after the oldest checkpoint
+class TokenStream {
+public:
+    TokenStream(Lexer *lexer, size_t capacity = 64);
+    // the tokens [begin, end) of a materialized stream, followed by _EOF
+    TokenStream(const TokenStream &stream, size_t begin, size_t end);
+    ~TokenStream();
+
+    // saved position in the stream;
+    // tokens after it stay buffered until it is released or destroyed
+    class Checkpoint {
+    public:
+        Checkpoint(TokenStream &stream);
+        ~Checkpoint();
+
+        // go back to the saved position
+        void rewind();
+        // stop keeping the tokens (can't rewind anymore)
+        void release();
+        // token at the saved position
+        Token token();
+
+    private:
+        TokenStream &stream;
+        size_t position;
+        bool active;
+    };
+
+    // tokens are returned by value, the ring may grow on the next access
+    // (the pointer of operator-> is only valid until then)
+
+    // current token
+    Token operator*();
+    const Token *operator->();
+    // token relative to the current one (-1 is the previous token)
+    Token peek(int64_t steps = 1);
+
+    // advance to the next token(s)
+    // (the lexer returns _EOF after the end, so this never runs out of tokens)
+    TokenStream &operator++();
+    TokenStream &operator+=(size_t steps);
+
+    // absolute index of the current token
+    size_t position() const;
+    // absolute index of the bracket matching the current token,
+    // lexing until it is found (index of _EOF if there is none)
+    size_t partner();
+
+    // lex the whole source up front (in parallel for large files)
+    // and read from the lexer's tokens from now on
+    void materialize();
+
+    // get token at absolute index, lexing until it is available
+    Token at(size_t index);
+
+    void debugPrint(const Token &token);
+
+private:
+    Lexer *lexer;
+    Token::Vec ring;            // size is a power of two
+    vector<size_t> pins;        // positions of active checkpoints
+    size_t current;             // absolute index of the current token
+    size_t lexed;               // amount of tokens lexed so far
+    Token none;                 // returned for positions before the first token
+    Token::Vec *tokens;         // all tokens after materialize()
+    size_t limit;               // tokens from here on are _EOF (the first _EOF of the lexer once it is reached)
+    Token end;                  // returned for positions from limit on
+    // oldest absolute index that has to stay in the ring
+    size_t oldest() const;
+    // double the size of the ring
+    void grow();
+};
\ No newline at end of file
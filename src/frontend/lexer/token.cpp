@@ -11,35 +11,61 @@
 
 #include "token.hpp"
 
-Token::Token(TokenType type, string value) 
-: type(type), value(value), line(1), start(1), end(1) {}
-
-Token::~Token() { value.clear(); }
-
-Token &Token::operator=(const Token &copy) {
-    this->type = copy.type;
-    this->value = copy.value;
-    this->line = copy.line;
-    this->start = copy.start;
-    this->end = copy.end;
-    return *this;
-}
+Token::Token(TokenType type, size_t offset, size_t length, size_t line, uint32_t payload) 
+: offset(offset), length(length), line(std::min(line, maxLine)), type(type), payload(payload) {}
 
 bool Token::operator==(TokenType type) const { return this->type == type; }
 
 bool Token::operator!=(TokenType type) const { return this->type != type; }
 
-string Token::str() const {
+size_t Token::column(const SourceBuffer &source) const {
+    if (line < maxLine) // _EOF after a trailing newline is on the line behind the last one (offset 0 of it)
+        return offset - std::min<size_t>(offset, source.lineOffset(line)) + 1;
+
+    const string_view view = source.view();
+    const size_t newline = view.rfind('\n', offset ? offset - 1 : 0);
+    if (newline == string_view::npos || newline >= offset)
+        return offset + 1;
+    return offset - newline;
+}
+
+size_t Token::end(const SourceBuffer &source) const {
+    const size_t start = column(source);
+    if (type == _EOF)
+        return start + 1;
+    return length ? start + length - 1 : start;
+}
+
+string_view Token::text(string_view source) const {
+    string_view value = source.substr(offset, length);
+
+    switch (type) {
+        case _EOF:      return TokenTypeValue[_EOF];
+        case STRING:
+        case CHAR: { // remove quotes
+            const char quote = value.front();
+            value.remove_prefix(1);
+            if (!value.empty() && value.back() == quote)
+                value.remove_suffix(1);
+            return value;
+        }
+        default:        return value;
+    }
+}
+
+string Token::str(const SourceBuffer &source) const {
     stringstream ss;
     ss  << "<Token, " << TokenTypeString[type] << ", '"  
-        << value << "', "
-        << "Line " << line << ":" << start << ">";
+        << text(source.view()) << "', "
+        << "Line " << line << ":" << column(source) << ">";
     // <Token, TYPE, 'value', Line line:start>
     return ss.str();
 }
 
 bool Token::isKeyword() const { return (type >= KEY_GET && type <= KEY_CLASS); }
 
+bool Token::isNumber() const { return (type >= NUMBER && type <= BINARY); }
+
 bool Token::isType() const { return ((type >= KEY_VOID && type <= KEY_VAR) || type == IDENTIFIER); }
 
 bool Token::isModifier() const { return (type >= KEY_SAFE && type <= KEY_ASYNC); }
@@ -12,8 +12,9 @@
 #pragma once
 
 #include "../../fux.hpp"
+#include "../../util/buffer.hpp"
 
-enum TokenType {
+enum TokenType : uint8_t {
 
     // structure
     LPAREN,         // (
@@ -302,7 +303,7 @@ static const char *TokenTypeString[] = {
     "NONE",
 };
 
-static vector<string> TokenTypeValue = {
+static constexpr const char *TokenTypeValue[] = {
     // structure
     "(",     
     ")",        
@@ -333,7 +334,7 @@ static vector<string> TokenTypeValue = {
     "|=",      
     "&=",     
     "<|=",
-    "=|>",
+    "|>=",
     "<>", 
 
     // condition
@@ -446,28 +447,45 @@ static vector<string> TokenTypeValue = {
     "none",
 };
 
+// tokens do not own their text or column, both are taken from the source on demand
+// (the column from the line table of the SourceBuffer);
+// 16 bytes, so four tokens fit into one cache line
 class Token {
 public:
     typedef vector<Token> Vec;
     typedef Vec::iterator Iter;
 
-    Token(TokenType type = NONE, string value = "");
-    ~Token();
+    static constexpr size_t maxLine = (1 << 24) - 1;
+
+    Token(TokenType type = NONE, size_t offset = 0, size_t length = 0, size_t line = 1, uint32_t payload = 0);
 
-    Token &operator=(const Token &copy);
     bool operator==(TokenType type) const;
     bool operator!=(TokenType type) const;
 
-    TokenType type;
-    string value;
-    size_t line, start, end;
+    uint32_t offset;    // index of the first character in the source
+    uint32_t length;    // amount of characters in the source
+    uint32_t line : 24; // (clamped to maxLine)
+    TokenType type : 8;
+    uint32_t payload;   // SymbolId of identifiers, value of numbers (see Lexer::number())
+
+    // column of the first character
+    size_t column(const SourceBuffer &source) const;
+    // column of the last character
+    size_t end(const SourceBuffer &source) const;
+
+    // value of the token
+    // (strings and chars without quotes, numbers with '_')
+    string_view text(string_view source) const;
 
-    string str() const;
+    string str(const SourceBuffer &source) const;
 
     bool isKeyword() const;
+    bool isNumber() const;
     bool isType() const;
     bool isModifier() const;
     bool isRelational() const;
     bool isAssignment() const;
     bool isInbuiltCall() const;
-};
\ No newline at end of file
+};
+
+static_assert(sizeof(Token) == 16, "Token should fit into 16 bytes");
\ No newline at end of file
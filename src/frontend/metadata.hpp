@@ -12,9 +12,10 @@
 #pragma once
 
 #include "../fux.hpp"
+#include "../util/buffer.hpp"
 
 struct Metadata {
-    Metadata(const string *fileName = nullptr, vector<string> *source = nullptr, 
+    Metadata(const string *fileName = nullptr, const SourceBuffer *source = nullptr, 
         size_t fstLine = 0, size_t lstLine = 0, 
         size_t fstCol = 0, size_t lstCol = 0) 
     : file(fileName), source(source), fstLine(fstLine), lstLine(lstLine), 
@@ -31,10 +32,9 @@ struct Metadata {
     }
 
     // get line from source code (line number, not index!)
-    string &operator[](size_t line) { return source->at(line - 1); }
-    const string &operator[](size_t line) const { return source->at(line - 1); }
+    string_view operator[](size_t line) const { return source->line(line); }
 
     const string *file;
-    vector<string> *source;
+    const SourceBuffer *source;
     size_t fstLine, lstLine, fstCol, lstCol;
 };
\ No newline at end of file
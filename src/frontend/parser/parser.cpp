@@ -11,33 +11,78 @@
 
 #include "parser.hpp"
 
-Parser::Parser(ErrorManager *error, const string &fileName, const string &source, const bool mainFile) 
-: fileName(fileName), error(error), mainFile(mainFile) {
-    lexer = new Lexer(source, fileName, error);
+Parser::Parser(ErrorManager *error, const string &fileName, const SourceBuffer *buffer, const bool mainFile, const bool lazy) 
+: fileName(fileName), buffer(*buffer), source(buffer->view()), error(error), 
+    lexer(new Lexer(buffer, fileName, error)), current(lexer), mainFile(mainFile), lazy(lazy), owner(this) {
     if (mainFile)
-        fux.options.fileLines = lexer->getLines();
+        fux.options.fileBuffer = lexer->getBuffer();
     root = make_unique<RootAST>();
+    literals = &root->literals;
 }
 
-Parser::~Parser() {
-    delete lexer;
-    tokens.clear();
+Parser::Parser(Parser &file, ErrorManager *error, size_t begin, size_t end, size_t sizeBase)
+: fileName(file.fileName), buffer(file.buffer), source(file.source), error(error), 
+    lexer(file.lexer), current(file.current, begin, end), mainFile(false), range(true), sizeBase(sizeBase), 
+    lazy(file.lazy), owner(file.owner), literals(file.literals) {
+    root = make_unique<RootAST>();
+}
+
+Parser::~Parser() { 
+    if (!range)
+        delete lexer; 
 }
 
 RootAST::Ptr Parser::parse() {
-    // lexing
-    tokens = lexer->lex();
-    lexer->debugPrint();
-    
-    current = tokens.begin();
+    arena = Arena::current;
+    fileRoot = root.get();
+
+    // tokens are lexed on demand by current,
+    // large files are lexed up front and parsed on all cores instead
+    // (lazy bodies need all tokens later)
+    const size_t amount = lexer->chunks();
+    if (amount > 1 || lazy)
+        current.materialize();
+    if (amount > 1 && parseRanges(amount))
+        return std::move(root);
+
+    parseProgram();
+    return std::move(root);
+}
 
+void Parser::parseProgram() {
     StmtAST::Ptr branch;
-    while (notEOF()) 
+    while (notEOF()) {
+        const size_t errors = error->errors();
         if ((branch = parseStmt())) // check for nullptr in case of error
             root->addSub(branch);
-    
-    return std::move(root);
-}
+        endedInError = error->errors() > errors;
+    }
+}
+
+const std::array<Parser::StmtParser, NONE + 1> Parser::stmtParsers = [] {
+    std::array<StmtParser, NONE + 1> table;
+    table.fill(&Parser::parseExprStmt);
+    table[IDENTIFIER] = &Parser::parseFunctionDeclStmt;
+    table[KEY_FOR] = &Parser::parseForLoopStmt;
+    table[KEY_DO] = table[KEY_WHILE] = &Parser::parseWhileLoopStmt;
+    table[LBRACE] = &Parser::parseBlockStmt;
+    table[KEY_IF] = &Parser::parseIfElseStmt;
+    for (int type = KEY_RETURN; type <= KEY_FREE; type++)
+        table[type] = &Parser::parseInbuiltCallStmt;
+    return table;
+}();
+
+// statements that end with a body don't need a semicolon (don't throw useless errors)
+static constexpr std::array<bool, (size_t) AST::RootAST + 1> needsSemicolon = [] {
+    std::array<bool, (size_t) AST::RootAST + 1> table {};
+    table.fill(true);
+    table[(size_t) AST::CodeBlockAST] = false;
+    table[(size_t) AST::FunctionAST] = false;
+    table[(size_t) AST::IfElseAST] = false;
+    table[(size_t) AST::WhileLoopAST] = false;
+    table[(size_t) AST::ForLoopAST] = false;
+    return table;
+}();
 
 StmtAST::Ptr Parser::parseStmt(bool expectSemicolon) {
     if (*current == SEMICOLON) { // handle while (...); or for (;;);
@@ -46,51 +91,42 @@ StmtAST::Ptr Parser::parseStmt(bool expectSemicolon) {
         return make_unique<NoOperationAST>();
     }
 
-    StmtAST::Ptr stmt = parseFunctionDeclStmt();
-    // TODO: get rid of this if
-    if (expectSemicolon && stmt 
-    && stmt->getASTType() != AST::CodeBlockAST 
-    && stmt->getASTType() != AST::FunctionAST
-    && stmt->getASTType() != AST::IfElseAST
-    && stmt->getASTType() != AST::WhileLoopAST
-    && stmt->getASTType() != AST::ForLoopAST) // don't throw useless errors
+    StmtAST::Ptr stmt = (this->*stmtParsers[current->type])();
+    if (expectSemicolon && stmt && needsSemicolon[(size_t) stmt->getASTType()])
         eat(SEMICOLON);
     return stmt;
 }
 
 StmtAST::Ptr Parser::parseFunctionDeclStmt() {
-    if (*current != IDENTIFIER) 
-        return parseForLoopStmt();
+    TokenStream::Checkpoint backToken(current);
+    const SymbolId symbol = getSymbol(eat());
 
-    Token::Iter backToken = current;
-    string symbol = eat().value;
-
-    if (!check(LPAREN)) {
-        current = backToken;
-        return parseForLoopStmt();
+    if (*current != LPAREN) {
+        backToken.rewind();
+        return parseVariableDeclStmt();
     }
     
-    Token::Iter paramBegin = current;
-    for (size_t depth = 1;;) {
-        if      (check(LPAREN)) ++depth;
-        else if (check(RPAREN)) --depth; // we don't care about any errors here, so we don't check wether depth is < 0
-        else if (check(_EOF))   {
-            createError(ParseError::MISSING_PAREN, "Expected Closing Paren after Parameter List", peek(-1), "Expected closing paren here",
-                *paramBegin, "Opening paren found here"); 
-            recover();
-            break;
-        } else                  eat();
-
-        if (depth <= 0)
-            break;
-    } // skip ( ... )
+    const size_t closing = current.partner();
+    eat();
+    TokenStream::Checkpoint paramBegin(current);
+    current += closing - current.position(); // skip ( ... )
+    if (check(_EOF)) {
+        createError(ParseError::MISSING_PAREN, "Expected Closing Paren after Parameter List", peek(-1), "Expected closing paren here",
+            paramBegin.token(), "Opening paren found here"); 
+        recover();
+    } else
+        eat();
 
     if (*current != COLON && *current != POINTER) {
-        current = backToken;
+        backToken.rewind();
+        backToken.release();
+        paramBegin.release();
         return parseExpr(); // We have to call parseExpr() instead of parseCallExpr() to handle situations like this one:
                             // someCall() << someArgument;
     } else
-        current = paramBegin;
+        paramBegin.rewind();
+    backToken.release();
+    paramBegin.release();
 
     StmtAST::Vec args = StmtAST::Vec();
     
@@ -109,11 +145,31 @@ StmtAST::Ptr Parser::parseFunctionDeclStmt() {
         return make_unique<PrototypeAST>(type, symbol, args);
 
     FunctionAST::Ptr node = make_unique<FunctionAST>(type, symbol, args);
+    if (lazy && *current == LBRACE && lexer->partner(current.position()) != Lexer::noPartner) {
+        const size_t begin = current.position();
+        const size_t end = lexer->partner(begin) + 1;
+        current += end - begin;
+        Parser *file = owner;
+        node->setLazyBody([file, begin, end](FunctionAST &function) { file->parseBody(function, begin, end); });
+        return node;
+    }
+
     parent = &*node;    
     StmtAST::Ptr body = parseStmt();
     parent = nullptr;
     node->setBody(body);
-    return std::move(node);
+    return node;
+}
+
+void Parser::parseBody(FunctionAST &function, size_t begin, size_t end) {
+    // the body shares the arena and the size expressions of the file
+    std::lock_guard<std::mutex> guard(bodies);
+    Arena::Scope scope(arena);
+    Parser parser = Parser(*this, error, begin, end, fileRoot->countSizeExprs());
+    parser.parent = &function;
+    StmtAST::Ptr body = parser.parseStmt();
+    function.setBody(body);
+    fileRoot->append(*parser.root);
 }
 
 StmtAST::Ptr Parser::parseForLoopStmt() { 
@@ -122,9 +178,7 @@ StmtAST::Ptr Parser::parseForLoopStmt() {
     ExprAST::Ptr cond = nullptr;
     ExprAST::Ptr iter = nullptr;
 
-    if (!check(KEY_FOR))
-        return parseWhileLoopStmt();
-
+    eat(); // for
     eat(LPAREN);
 
     init = parseStmt(false); 
@@ -162,70 +216,59 @@ StmtAST::Ptr Parser::parseWhileLoopStmt() {
         eat(LPAREN);
         condition = parseExpr();
         eat(RPAREN, ParseError::MISSING_PAREN);
-    } else if (check(KEY_WHILE)) {
+    } else {
+        eat(); // while
         eat(LPAREN);
         condition = parseExpr();
         eat(RPAREN, ParseError::MISSING_PAREN);
         body = parseStmt();
-    } else
-        return parseBlockStmt();
+    }
 
     return make_unique<WhileLoopAST>(condition, body, postCondition);
 }
 
 StmtAST::Ptr Parser::parseBlockStmt() {
-    if (check(LBRACE)) {
-        Token &opening = peek(-1); // '{' position for error reporting 
-        StmtAST::Vec body;
-        while (!check(RBRACE)) {
-            if (!notEOF()) {
-                createError(ParseError::MISSING_PAREN, "Code Block was never closed", *(current - 1), "Expected a closing paren (RBRACE '}') here", 
-                    opening, "Opening paren found here (LBRACE '{')");
-                return make_unique<NoOperationAST>(); 
-            }
-            body.push_back(parseStmt());
+    Token opening = eat(); // '{' position for error reporting 
+    StmtAST::Vec body;
+    while (!check(RBRACE)) {
+        if (!notEOF()) {
+            createError(ParseError::MISSING_PAREN, "Code Block was never closed", peek(-1), "Expected a closing paren (RBRACE '}') here", 
+                opening, "Opening paren found here (LBRACE '{')");
+            return make_unique<NoOperationAST>(); 
         }
-        return make_unique<CodeBlockAST>(body);
-    } 
-    
-    return parseIfElseStmt();
+        body.push_back(parseStmt());
+    }
+    return make_unique<CodeBlockAST>(body);
 }
 
 StmtAST::Ptr Parser::parseIfElseStmt() {
-    if (check(KEY_IF)) {
-        eat(LPAREN);
-        ExprAST::Ptr condition = parseExpr();
-        eat(RPAREN, ParseError::MISSING_PAREN);
-        StmtAST::Ptr thenBody = parseStmt(); 
-        if (check(KEY_ELSE)) {
-            StmtAST::Ptr elseBody = parseStmt(); 
-            return make_unique<IfElseAST>(condition, thenBody, elseBody);
-        } 
-        return make_unique<IfElseAST>(condition, thenBody);
+    eat(); // if
+    eat(LPAREN);
+    ExprAST::Ptr condition = parseExpr();
+    eat(RPAREN, ParseError::MISSING_PAREN);
+    StmtAST::Ptr thenBody = parseStmt(); 
+    if (check(KEY_ELSE)) {
+        StmtAST::Ptr elseBody = parseStmt(); 
+        return make_unique<IfElseAST>(condition, thenBody, elseBody);
     } 
-
-    return parseInbuiltCallStmt();
+    return make_unique<IfElseAST>(condition, thenBody);
 }
 
 StmtAST::Ptr Parser::parseInbuiltCallStmt() {
-    if (current->isInbuiltCall()) {
-        Inbuilts callee = (Inbuilts) eat().type;
-        ExprAST::Vec args = parseExprList(SEMICOLON);
-        return make_unique<InbuiltCallAST>(callee, args);
-    }
-
-    return parseVariableDeclStmt();
+    Inbuilts callee = (Inbuilts) eat().type;
+    ExprAST::Vec args = parseExprList(SEMICOLON);
+    return make_unique<InbuiltCallAST>(callee, args);
 }
 
 StmtAST::Ptr Parser::parseVariableDeclStmt() {
     if (*current != IDENTIFIER || (peek() != COLON && peek() != POINTER))
         return parseExpr();
     
-    const string symbol = eat().value; // get value from identifier
+    const SymbolId symbol = getSymbol(eat());
     FuxType type = parseType();
 
     if (check(TRIPLE_EQUALS)) // ===
-        type.access.push_back(FuxType::CONSTANT);
+        type = type.with(FuxType::CONSTANT);
     else if (!check(EQUALS)) {
         StmtAST::Ptr decl = make_unique<VariableDeclAST>(symbol, type);
         if (parent) {
@@ -244,6 +287,8 @@ StmtAST::Ptr Parser::parseVariableDeclStmt() {
     return std::move(decl);
 }
 
+StmtAST::Ptr Parser::parseExprStmt() { return parseExpr(); }
+
 ExprAST::Vec Parser::parseExprList(TokenType end) { 
     ExprAST::Vec list = ExprAST::Vec();
     ExprAST::Ptr expr = parseExpr();
@@ -258,238 +303,108 @@ ExprAST::Vec Parser::parseExprList(TokenType end) {
 }
  
 
-ExprAST::Ptr Parser::parseExpr() { return parseAssignmentExpr(); }
+ExprAST::Ptr Parser::parseExpr() { return parseBinaryExpr(Precedence::ASSIGNMENT); }
 
-ExprAST::Ptr Parser::parseAssignmentExpr() { 
-    ExprAST::Ptr dest = parsePipeExpr();
+ExprAST::Ptr Parser::parseBinaryExpr(Precedence min) {
+    ExprAST::Ptr LHS = parseUnaryExpr();
 
-    if (current->isAssignment()) {
-        BinaryOp op = (BinaryOp) eat().type;
-        ExprAST::Ptr value = parsePipeExpr();
-        dest = make_unique<BinaryExprAST>(op, dest, value);
-    }
-    
-    return dest;
-}
-
-ExprAST::Ptr Parser::parsePipeExpr() {
-    ExprAST::Ptr LHS = parseTernaryExpr();
-
-    while (*current == LSHIFT || *current == RSHIFT) {
-        BinaryOp op = (BinaryOp) eat().type;
-        ExprAST::Ptr RHS = parseTernaryExpr();
-        LHS = make_unique<BinaryExprAST>(op, LHS, RHS);
-    }
-
-    return LHS;
-}
-
-ExprAST::Ptr Parser::parseTernaryExpr() { 
-    ExprAST::Ptr condition = parseLogicalOrExpr();
-
-    while (check(QUESTION)) {
-        ExprAST::Ptr thenExpr = parseLogicalOrExpr();
-        eat(COLON);
-        ExprAST::Ptr elseExpr = parseLogicalOrExpr();
-        condition = make_unique<TernaryExprAST>(condition, thenExpr, elseExpr);
-    }
-
-    return condition; 
-}
-
-ExprAST::Ptr Parser::parseLogicalOrExpr() { 
-    ExprAST::Ptr LHS = parseLogicalAndExpr();
-
-    while (check(OR)) {
-        ExprAST::Ptr RHS = parseLogicalAndExpr();
-        LHS = make_unique<BinaryExprAST>(BinaryOp::LOR, LHS, RHS);
-    }
-
-    return LHS;
- }
-
-ExprAST::Ptr Parser::parseLogicalAndExpr() { 
-    ExprAST::Ptr LHS = parseBitwiseOrExpr();
-
-    while (check(AND)) {
-        ExprAST::Ptr RHS = parseBitwiseOrExpr();
-        LHS = make_unique<BinaryExprAST>(BinaryOp::LAND, LHS, RHS);
-    }
-
-    return LHS;
- }
-
-ExprAST::Ptr Parser::parseBitwiseOrExpr() {
-    ExprAST::Ptr LHS = parseBitwiseXorExpr();
-
-    while (check(BIT_OR)) {
-        ExprAST::Ptr RHS = parseBitwiseXorExpr();
-        LHS = make_unique<BinaryExprAST>(BinaryOp::BOR, LHS, RHS);
-    }
+    for (;;) {
+        const Precedence precedence = BinaryOpPrecedence[current->type];
+        if (precedence == Precedence::NONE || precedence < min)
+            return LHS;
 
-    return LHS;
-}
-
-ExprAST::Ptr Parser::parseBitwiseXorExpr() { 
-    ExprAST::Ptr LHS = parseBitwiseAndExpr(); 
-
-    while (check(BIT_XOR)) {
-        ExprAST::Ptr RHS = parseBitwiseAndExpr();
-        LHS = make_unique<BinaryExprAST>(BinaryOp::BXOR, LHS, RHS);
-    }
-
-    return LHS;
-}
-
-ExprAST::Ptr Parser::parseBitwiseAndExpr() { 
-    ExprAST::Ptr LHS = parseEqualityExpr();
-
-    while (check(BIT_AND)) {
-        ExprAST::Ptr RHS = parseEqualityExpr();
-        LHS = make_unique<BinaryExprAST>(BinaryOp::BAND, LHS, RHS);
-    }
-
-    return LHS;
-}
-
-ExprAST::Ptr Parser::parseEqualityExpr() {
-    ExprAST::Ptr LHS = parseRelationalExpr();
-
-    while (*current == EQUALS_EQUALS || *current == NOT_EQUALS) {
-        BinaryOp op = (BinaryOp) eat().type;
-        ExprAST::Ptr RHS = parseRelationalExpr();
-        LHS = make_unique<BinaryExprAST>(op, LHS, RHS);
-    }
-
-    return LHS;
-}
-
-ExprAST::Ptr Parser::parseRelationalExpr() {
-    ExprAST::Ptr LHS = parseBitwiseShiftExpr();
+        if (check(QUESTION)) {
+            ExprAST::Ptr thenExpr = parseBinaryExpr(Precedence::LOR);
+            eat(COLON);
+            ExprAST::Ptr elseExpr = parseBinaryExpr(Precedence::LOR);
+            LHS = make_unique<TernaryExprAST>(LHS, thenExpr, elseExpr);
+            continue;
+        }
 
-    while (current->isRelational()) {
         BinaryOp op = (BinaryOp) eat().type;
-        ExprAST::Ptr RHS = parseBitwiseShiftExpr();
-        LHS = make_unique<BinaryExprAST>(op, LHS, RHS);
-    }
-
-    return LHS;
-}
-
-ExprAST::Ptr Parser::parseBitwiseShiftExpr() {
-    ExprAST::Ptr LHS = parseAdditiveExpr();
+        // an assignment takes a pipe and ends the expression
+        if (precedence == Precedence::ASSIGNMENT) {
+            ExprAST::Ptr value = parseBinaryExpr(Precedence::PIPE);
+            return make_unique<BinaryExprAST>(op, LHS, value);
+        }
 
-    while (*current == BIT_LSHIFT || *current == BIT_RSHIFT) {
-        BinaryOp op = (BinaryOp) eat().type;
-        ExprAST::Ptr RHS = parseAdditiveExpr();
+        // all binary operators are left-associative
+        ExprAST::Ptr RHS = parseBinaryExpr((Precedence) ((uint8_t) precedence + 1));
         LHS = make_unique<BinaryExprAST>(op, LHS, RHS);
     }
-
-    return LHS;
 }
 
-ExprAST::Ptr Parser::parseAdditiveExpr() {
-    ExprAST::Ptr LHS = parseMultiplicativeExpr();
+ExprAST::Ptr Parser::parseUnaryExpr() {
+    // every prefix may only appear once and in this order
+    UnaryOp prefixes[5];
+    size_t count = 0;
 
-    while (*current == PLUS || *current == MINUS) {
-        BinaryOp op = (BinaryOp) eat().type;
-        ExprAST::Ptr RHS = parseMultiplicativeExpr();
-        LHS = make_unique<BinaryExprAST>(op, LHS, RHS);
-    }
+    if (check(BIT_AND))
+        prefixes[count++] = UnaryOp::ADDR;
+    if (check(ASTERISK))
+        prefixes[count++] = UnaryOp::DEREF;
 
-    return LHS;
-}
-
-ExprAST::Ptr Parser::parseMultiplicativeExpr() {
-    ExprAST::Ptr LHS = parsePowerExpr();
-
-    while (*current == ASTERISK || *current == SLASH || *current == PERCENT) {
-        BinaryOp op = (BinaryOp) eat().type;
-        ExprAST::Ptr RHS = parsePowerExpr();
-        LHS = make_unique<BinaryExprAST>(op, LHS, RHS);
+    ExprAST::Ptr expr = parseTypeCastExpr();
+    if (!expr) {
+        if (*current == EXCLAMATION || *current == BIT_NOT || *current == QUESTION)
+            prefixes[count++] = (UnaryOp) eat().type;
+        if (*current == PLUS || *current == MINUS)
+            prefixes[count++] = (UnaryOp) eat().type;
+        if (*current == PLUS_PLUS || *current == MINUS_MINUS)
+            prefixes[count++] = eat() == PLUS_PLUS ? UnaryOp::PINC : UnaryOp::PDEC;
+        expr = parsePostfixExpr();
     }
 
-    return LHS;
-}
-
-ExprAST::Ptr Parser::parsePowerExpr() { 
-    ExprAST::Ptr LHS = parseAddressExpr();
-
-    while (check(CARET)) {
-        ExprAST::Ptr RHS = parseAddressExpr();
-        LHS = make_unique<BinaryExprAST>(BinaryOp::POW, LHS, RHS);
-    }    
-
-    return LHS;
+    while (count > 0)
+        expr = make_unique<UnaryExprAST>(prefixes[--count], expr);
+    return expr;
 }
 
-ExprAST::Ptr Parser::parseAddressExpr() { 
-    if (check(BIT_AND)) {
-        ExprAST::Ptr expr = parseDereferenceExpr();
-        return make_unique<UnaryExprAST>(UnaryOp::ADDR, expr);
-    }
-
-    return parseDereferenceExpr(); 
+ExprAST::Ptr Parser::parseTypeCastExpr() { 
+    if (*current != LPAREN)
+        return nullptr;
+
+    TokenStream::Checkpoint backToken(current);
+    eat();
+    FuxType type = parseType(true); // analyser will check wether type is primitive or not
+    if (!type || *current != RPAREN) { // TODO: test more possible cases
+        backToken.rewind(); // get '*'s, identifier and '(' back
+        backToken.release();
+        return nullptr;
+    }
+    backToken.release();
+    eat(RPAREN, ParseError::MISSING_PAREN);
+    ExprAST::Ptr expr = parseExpr();
+    return make_unique<TypeCastExprAST>(type, expr);
 }
 
-ExprAST::Ptr Parser::parseDereferenceExpr() { 
-    if (check(ASTERISK)) {
-        ExprAST::Ptr expr = parseTypeCastExpr();
-        return make_unique<UnaryExprAST>(UnaryOp::DEREF, expr);
-    }
-
-    return parseTypeCastExpr(); 
-}
+ExprAST::Ptr Parser::parsePostfixExpr() { 
+    ExprAST::Ptr expr = nullptr;
 
-ExprAST::Ptr Parser::parseTypeCastExpr() { 
-    Token::Iter backToken = current;
-    if (check(LPAREN)) {
-        FuxType type = parseType(true); // analyser will check wether type is primitive or not
-        if (!type || *current != RPAREN) { // TODO: test more possible cases
-            current = backToken; // get '*'s, identifier and '(' back
-            return parseLogBitUnaryExpr();
+    if (*current == IDENTIFIER || *current == KEY_ASYNC) {
+        TokenStream::Checkpoint backTok(current);
+        const bool asyncCall = check(KEY_ASYNC);
+        ExprAST::Ptr symbol = parsePrimaryExpr();
+        
+        if (check(LPAREN)) {
+            backTok.release();
+            ExprAST::Vec arguments = ExprAST::Vec();
+            if (*current != RPAREN)
+                arguments = parseExprList(RPAREN);
+            eat(RPAREN, ParseError::MISSING_PAREN);
+            expr = make_unique<CallExprAST>(symbol, arguments, asyncCall);
+        } else {
+            backTok.rewind();
+            backTok.release();
         }
-        eat(RPAREN, ParseError::MISSING_PAREN);
-        ExprAST::Ptr expr = parseExpr();
-        return make_unique<TypeCastExprAST>(type, expr);
     }
-   
-    return parseLogBitUnaryExpr(); 
-}
-
-ExprAST::Ptr Parser::parseLogBitUnaryExpr() { 
-    if (*current == EXCLAMATION || *current == BIT_NOT || *current == QUESTION) {
-        UnaryOp op = (UnaryOp) eat().type;
-        ExprAST::Ptr expr = parsePlusMinusUnaryExpr();
-        return make_unique<UnaryExprAST>(op, expr);
-    }
-
-    return parsePlusMinusUnaryExpr(); 
-}
 
-ExprAST::Ptr Parser::parsePlusMinusUnaryExpr() { 
-    if (*current == PLUS || *current == MINUS) {
-        UnaryOp op = (UnaryOp) eat().type;
-        ExprAST::Ptr expr = parsePreIncDecExpr();
-        return make_unique<UnaryExprAST>(op, expr);
+    if (!expr) {
+        expr = parsePrimaryExpr();
+        if (*current == PLUS_PLUS || *current == MINUS_MINUS)
+            expr = make_unique<UnaryExprAST>(eat() == PLUS_PLUS ? UnaryOp::SINC : UnaryOp::SDEC, expr);
     }
     
-    return parsePreIncDecExpr(); 
-}
-
-ExprAST::Ptr Parser::parsePreIncDecExpr() { 
-    if (*current == PLUS_PLUS || *current == MINUS_MINUS) {
-        UnaryOp op = eat() == PLUS_PLUS ? UnaryOp::PINC : UnaryOp::PDEC;
-        ExprAST::Ptr expr = parseIndexExpr();
-        return make_unique<UnaryExprAST>(op, expr);
-    } 
-    
-    return parseIndexExpr(); 
-}
-
-ExprAST::Ptr Parser::parseIndexExpr() { 
-    ExprAST::Ptr expr = parseCallExpr(); 
-    
     if (check(ARRAY_BRACKET)) 
         return make_unique<BinaryExprAST>(BinaryOp::IDX, expr);
     else if (check(LBRACKET)) {
@@ -501,42 +416,11 @@ ExprAST::Ptr Parser::parseIndexExpr() {
     return expr;
 }
 
-ExprAST::Ptr Parser::parseCallExpr() { 
-    if (*current != IDENTIFIER && *current != KEY_ASYNC)
-        return parsePostIncDecExpr();
-
-    bool asyncCall = false;
-    Token::Iter backTok = current;
-    
-    if (check(KEY_ASYNC))
-        asyncCall = true;
-    ExprAST::Ptr symbol = parsePrimaryExpr();
-        
-    if (!check(LPAREN)) {
-        current = backTok;
-        return parsePostIncDecExpr();
-    }
-
-    ExprAST::Vec arguments = ExprAST::Vec();
-    if (*current != RPAREN)
-        arguments = parseExprList(RPAREN);
-    eat(RPAREN, ParseError::MISSING_PAREN);
-    return make_unique<CallExprAST>(symbol, arguments, asyncCall);
-} 
-
-ExprAST::Ptr Parser::parsePostIncDecExpr() {
-    ExprAST::Ptr expr = parsePrimaryExpr();
-    if (*current == PLUS_PLUS || *current == MINUS_MINUS)
-        return make_unique<UnaryExprAST>(
-            eat() == PLUS_PLUS ? UnaryOp::SINC : UnaryOp::SDEC, expr);
-    return expr;
-}
-
 ExprAST::Ptr Parser::parsePrimaryExpr() {
     Token that = eat();
 
     if (that.isKeyword() && that != IDENTIFIER)
-        return make_unique<VariableExprAST>(that.value);
+        return make_unique<VariableExprAST>(getSymbol(that));
 
     switch (that.type) {
         case HEXADECIMAL:
@@ -554,22 +438,22 @@ ExprAST::Ptr Parser::parsePrimaryExpr() {
                     endExpr = parseNumberExpr(endTok);
                 else 
                     error->simpleError(ParseError::ILLEGAL_OPERANDS, "Incomplete Range Expression", fileName,
-                        that.line, endTok.line, that.start, endTok.end, "Range expression indicated by '...' operator.", 
-                        endTok.start, "Would have expected an integer here.", 
+                        that.line, endTok.line, that.column(buffer), endTok.end(buffer), "Range expression indicated by '...' operator.", 
+                        endTok.column(buffer), "Would have expected an integer here.", 
                         {"Help: The LHS and the RHS of a range expression have to be constants."});
                 
                 return make_unique<RangeExprAST>(beginExpr, endExpr);
             }
             return beginExpr;
         }
-        case FLOAT:         return make_unique<NumberExprAST, _f64>(stod(that.value));
+        case FLOAT:         return make_unique<NumberExprAST, _f64>(std::bit_cast<_f64>(lexer->number(that)));
         case CHAR:          return parseCharExpr(that);
-        case STRING:        return make_unique<StringExprAST>(escapeSequences(that.value)); 
+        case STRING:        return make_unique<StringExprAST>(*literals, escapeSequences(string(that.text(source)))); 
         case KEY_TRUE:      return make_unique<BoolExprAST>(true);
         case KEY_FALSE:     return make_unique<BoolExprAST>(false);
         case KEY_NULL:      return make_unique<NullExprAST>();
         case IDENTIFIER:    {
-            ExprAST::Ptr primary = make_unique<VariableExprAST>(that.value);
+            ExprAST::Ptr primary = make_unique<VariableExprAST>(getSymbol(that));
 
             if (!check(DOT)) 
                 return primary;
@@ -594,8 +478,10 @@ ExprAST::Ptr Parser::parsePrimaryExpr() {
         }
         default: {        
             createError(ParseError::UNEXPECTED_TOKEN, "Unexpected Token while parsing Primary Expression",
-                that, "Unexpected token "+string(TokenTypeString[that.type])+" '"+that.value+"'");
+                that, "Unexpected token "+string(TokenTypeString[that.type])+" '"+string(that.text(source))+"'");
             recover();
+            if (fuxCancel.cancelled())
+                return nullptr;
             return parsePrimaryExpr();
         }
     }
@@ -609,14 +495,15 @@ FuxType Parser::parseType(bool primitive) {
         if (!current->isType()) 
             return FuxType(FuxType::NO_TYPE, pointerDepth);
         const FuxType::Kind kind = (FuxType::Kind) current->type;
-        const string &value = eat().value;
-        return FuxType::createPrimitive(kind, pointerDepth, check(ARRAY_BRACKET), value);
+        const SymbolId name = kind == FuxType::CUSTOM ? getSymbol(*current) : SymbolPool::none;
+        eat();
+        return FuxType::createPrimitive(kind, pointerDepth, check(ARRAY_BRACKET), name);
     }
 
-    FuxType::AccessList access = {FuxType::PUBLIC};
+    FuxType::AccessMask access = FuxType::bit(FuxType::PUBLIC);
     int64_t pointerDepth;
 
-    Token &typeDenotion = eat(); // ':' or '->' for error tracking
+    Token typeDenotion = eat(); // ':' or '->' for error tracking
     switch (typeDenotion.type) {
         case COLON:     pointerDepth = 0; break;
         case POINTER:  pointerDepth = -1; break;
@@ -627,7 +514,7 @@ FuxType Parser::parseType(bool primitive) {
     }
 
     while (current->isModifier())
-        access.push_back((FuxType::Access) eat().type);
+        access |= FuxType::bit((FuxType::Access) eat().type);
     
     while (check(ASTERISK)) {
         if (pointerDepth != -1) {
@@ -650,62 +537,56 @@ FuxType Parser::parseType(bool primitive) {
     }
 
     const FuxType::Kind kind = (FuxType::Kind) current->type;
-    const string &value = eat().value;
+    const SymbolId name = kind == FuxType::CUSTOM ? getSymbol(*current) : SymbolPool::none;
+    eat();
 
     if (check(ARRAY_BRACKET)) 
-        return FuxType::createArray(kind, pointerDepth, access, value);
+        return FuxType::createArray(kind, pointerDepth, access, name);
     else if (check(LBRACKET)) {
         ExprAST::Ptr size = parseExpr();
         eat(RBRACKET, ParseError::MISSING_PAREN);
-        return FuxType::createArray(kind, pointerDepth, access, value, root->addSizeExpr(size));
+        return FuxType::createArray(kind, pointerDepth, access, name, sizeBase + root->addSizeExpr(size));
     } else 
-        return FuxType::createStd(kind, pointerDepth, access, value);
+        return FuxType::createStd(kind, pointerDepth, access, name);
 
     assert(false && "unreachable");
 }
 
-ExprAST::Ptr Parser::parseNumberExpr(Token &tok) {
-    _u64 value;
-    switch (tok.type) {
-        case HEXADECIMAL:   value = std::stoull(tok.value, nullptr, 16); break;
-        case NUMBER:        value = std::stoull(tok.value); break;
-        case OCTAL:         
-            tok.value.erase(1, 1); // "0o..." -> "0..."
-            value = std::stoull(tok.value, nullptr, 8); 
-            break;
-        case BINARY:        
-            tok.value.erase(0, 2); // "0b..." -> "..."
-            value = std::stoull(tok.value, nullptr, 2); 
-            break;
-        default:            break; // unreachable
-    }
-    size_t bits = (size_t) log2(value) + 1; // get amount of bits in (binary) value
+ExprAST::Ptr Parser::parseNumberExpr(const Token &tok) {
+    const _u64 value = lexer->number(tok); // computed by the lexer
+    const int bits = std::bit_width(value);
     if      (bits <= 8)     return make_unique<NumberExprAST, _u8>(value);
     else if (bits <= 16)    return make_unique<NumberExprAST, _u16>(value);
     else if (bits <= 32)    return make_unique<NumberExprAST, _u32>(value);
-    else if (bits <= 64)    return make_unique<NumberExprAST>(value);
-    else                    return nullptr; // unreachable   
+    else                    return make_unique<NumberExprAST>(value);
 }
 
-ExprAST::Ptr Parser::parseCharExpr(Token &tok) {
+ExprAST::Ptr Parser::parseCharExpr(const Token &tok) {
     // TODO: add support for c16
     _c8 value;
-    value = escapeSequences(tok.value).front();
+    value = escapeSequences(string(tok.text(source))).front();
     return make_unique<CharExprAST>(value);
 }
 
-Token &Parser::eat() {
-    if (*current == _EOF)
-        return *current;
-    return *current++;
+SymbolId Parser::getSymbol(const Token &tok) {
+    if (tok == IDENTIFIER) // interned by the lexer
+        return tok.payload;
+    return fuxSymbols.intern(tok.text(source));
+}
+
+Token Parser::eat() {
+    Token token = *current;
+    if (token != _EOF)
+        ++current;
+    return token;
 }
 
-Token &Parser::eat(TokenType type, ParseError::Type errType) {
+Token Parser::eat(TokenType type, ParseError::Type errType) {
     Token curTok = eat();
 
     if (curTok != type) {
-        createError(errType, "Got Unexpected Token "+string(TokenTypeString[curTok.type])+" '"+curTok.value+"'", 
-            peek(-1), "Previous token", curTok.start, 
+        createError(errType, "Got Unexpected Token "+string(TokenTypeString[curTok.type])+" '"+string(curTok.text(source))+"'", 
+            peek(-1), "Previous token", curTok.column(buffer), 
             "Expected "+string(TokenTypeString[type])+" '"+TokenTypeValue[type]+"' here instead"); 
         // TODO: better error
         recover();
@@ -714,7 +595,7 @@ Token &Parser::eat(TokenType type, ParseError::Type errType) {
     return *current; 
 }
 
-Token &Parser::peek(size_t steps) { return *(current + steps); }
+Token Parser::peek(int64_t steps) { return current.peek(steps); }
 
 bool Parser::check(TokenType type) {
     if (*current != type) 
@@ -732,25 +613,25 @@ bool Parser::check(TokenType type, TokenType type0) {
     return true;
 }
 
-void Parser::recover(TokenType type) { while (*current != type && *current != _EOF) eat(); }
+void Parser::recover(TokenType type) { while (*current != type && notEOF()) eat(); }
 
-constexpr bool Parser::notEOF() { return *current != _EOF; }
+constexpr bool Parser::notEOF() { return *current != _EOF && !fuxCancel.cancelled(); }
 
 void Parser::createError(
-    ParseError::Type type, string title, 
-    const Token &token, string info, size_t ptr, string ptrText,
-    vector<string> notes, bool warning, bool aggressive) {
-        error->simpleError(type, title, fileName, token.line, token.line, token.start, token.end, 
+    ParseError::Type type, string_view title, 
+    const Token &token, string_view info, size_t ptr, string_view ptrText,
+    const vector<string> &notes, bool warning, bool aggressive) {
+        error->simpleError(type, title, fileName, token.line, token.line, token.column(buffer), token.end(buffer), 
             info, ptr, ptrText, notes, warning, aggressive);
 }
 
 void Parser::createError(
-    ParseError::Type type, string title,
-    const Token &token, string info, 
-    const Token &refTok, string refInfo,
-    vector<string> notes, bool warning, bool aggressive) {
+    ParseError::Type type, string_view title,
+    const Token &token, string_view info, 
+    const Token &refTok, string_view refInfo,
+    const vector<string> &notes, bool warning, bool aggressive) {
         error->createError(type, title, 
-            fileName, token.line, token.line, token.start, token.end, info, 0, "", 
-            fileName, refTok.line, refTok.line, refTok.start, refTok.end, refInfo, 0, "",
+            fileName, token.line, token.line, token.column(buffer), token.end(buffer), info, 0, "", 
+            fileName, refTok.line, refTok.line, refTok.column(buffer), refTok.end(buffer), refInfo, 0, "",
             notes, true, warning, aggressive);
 }
\ No newline at end of file
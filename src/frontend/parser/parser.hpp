@@ -16,30 +16,64 @@
 #include "type.hpp"
 #include "../error/error.hpp"
 #include "../lexer/lexer.hpp"
+#include "../lexer/stream.hpp"
 #include "../lexer/token.hpp"
 
 class Parser {
 public:
-    Parser(ErrorManager *error, const string &fileName, const string &source, const bool mainFile = false);
+    // lazy: only find the end of function bodies and parse them when they are needed
+    // (see FunctionAST::getBody()), the parser has to outlive the ast then
+    Parser(ErrorManager *error, const string &fileName, const SourceBuffer *buffer, const bool mainFile = false, const bool lazy = false);
     ~Parser();
 
     // parse the Tokens and return AST root
     RootAST::Ptr parse();
 
 private:
+    // parser for the tokens [begin, end) of file (see parseRanges()),
+    // the size ids of its array types start at sizeBase
+    Parser(Parser &file, ErrorManager *error, size_t begin, size_t end, size_t sizeBase = 0);
+
     const string &fileName;
-    Token::Vec tokens;
-    Token::Iter current;
+    const SourceBuffer &buffer;
+    string_view source;
     ErrorManager *error;
     Lexer *lexer;
+    TokenStream current;
     RootAST::Ptr root;
     const bool mainFile;
+    const bool range = false;   // shares the lexer of the file's parser
+    size_t sizeBase = 0;
+    // the last statement had errors, while recovering the parser of the file
+    // might have continued past the end of this range
+    bool endedInError = false;
+    const bool lazy;
+    Parser *owner;              // parser of the file (this one unless range)
+    Arena *arena = nullptr;     // of the file, for lazy bodies
+    RootAST *fileRoot = nullptr;
+    LiteralPool *literals;      // of the file (in the root of its parser)
+    std::mutex bodies;          // lazy bodies of a file are parsed one at a time
 
     FunctionAST *parent = nullptr;
 
+    typedef StmtAST::Ptr (Parser::*StmtParser)();
+    // parser for the statements starting with a TokenType (expression if there is none)
+    static const std::array<StmtParser, NONE + 1> stmtParsers;
+
+    // parse statements until _EOF
+    void parseProgram();
+    // start of every range of top-level statements that can be parsed on its own,
+    // about amount of them (the last index is _EOF)
+    vector<size_t> findRanges(size_t amount);
+    // parse the ranges on worker threads and append them to root in order;
+    // false if the file has to be parsed serially instead (see endedInError)
+    bool parseRanges(size_t amount);
+    // parse the body of function from the tokens [begin, end)
+    void parseBody(FunctionAST &function, size_t begin, size_t end);
+
     // parse a statement
     StmtAST::Ptr parseStmt(bool expectSemicolon = true);
-    // function declaration
+    // function declaration (or variable declaration, expression)
     StmtAST::Ptr parseFunctionDeclStmt();
     // for (each) loop
     StmtAST::Ptr parseForLoopStmt();
@@ -51,61 +85,25 @@ private:
     StmtAST::Ptr parseIfElseStmt();
     // inbuilt call 
     StmtAST::Ptr parseInbuiltCallStmt();
-    // variable declaration
+    // variable declaration (or expression)
     StmtAST::Ptr parseVariableDeclStmt();
+    // expression as statement
+    StmtAST::Ptr parseExprStmt();
 
     // <expr>, <expr>, ...
     ExprAST::Vec parseExprList(TokenType end);
 
     // parse an expression
     ExprAST::Ptr parseExpr();
-    // <symbol> [...]= <value>
-    ExprAST::Ptr parseAssignmentExpr();
-    // <expr> <<|>> <expr>
-    ExprAST::Ptr parsePipeExpr();
-    // <expr> ? <expr> : <expr>
-    ExprAST::Ptr parseTernaryExpr();
-    // <expr> || <expr>
-    ExprAST::Ptr parseLogicalOrExpr();
-    // <expr> && <expr> 
-    ExprAST::Ptr parseLogicalAndExpr();
-    // <expr> | <expr> 
-    ExprAST::Ptr parseBitwiseOrExpr();
-    // <expr> >< <expr> 
-    ExprAST::Ptr parseBitwiseXorExpr();
-    // <expr> & <expr> 
-    ExprAST::Ptr parseBitwiseAndExpr();
-    // <expr> == <expr> , <expr> != <expr> 
-    ExprAST::Ptr parseEqualityExpr();
-    // <expr> < <expr> , <expr> <= <expr> , <expr> > <expr> , <expr> >= <expr> 
-    ExprAST::Ptr parseRelationalExpr();
-    // <expr> <| <expr> , <expr> |> <expr> 
-    ExprAST::Ptr parseBitwiseShiftExpr();
-    // <expr> + <expr> , <expr> - <expr> 
-    ExprAST::Ptr parseAdditiveExpr();
-    // <expr> * <expr> , <expr> / <expr> , <expr> % <expr> 
-    ExprAST::Ptr parseMultiplicativeExpr();
-    // <expr> ^ <expr> 
-    ExprAST::Ptr parsePowerExpr();
-
-    // & <expr>
-    ExprAST::Ptr parseAddressExpr();
-    // * <expr>
-    ExprAST::Ptr parseDereferenceExpr();
-    // ( <type> ) <expr>
+    // <expr> <op> <expr> with operators that bind at least as strong as min
+    // (precedence climbing, see BinaryOpPrecedence)
+    ExprAST::Ptr parseBinaryExpr(Precedence min);
+    // & * (<type>) !~? +- ++-- <expr>
+    ExprAST::Ptr parseUnaryExpr();
+    // ( <type> ) <expr> (nullptr if there's no type cast)
     ExprAST::Ptr parseTypeCastExpr();
-    //° ! (log not), ~ (bit not), ? (existence)
-    ExprAST::Ptr parseLogBitUnaryExpr();
-    // + <expr> , - <expr> 
-    ExprAST::Ptr parsePlusMinusUnaryExpr();
-    // ++<expr> , --<expr> 
-    ExprAST::Ptr parsePreIncDecExpr();
-    // <expr> [ <expr> ]
-    ExprAST::Ptr parseIndexExpr();
-    // <expr>  ( <expr>, <expr>, ... )
-    ExprAST::Ptr parseCallExpr();
-    // <expr>++, <expr>--
-    ExprAST::Ptr parsePostIncDecExpr();
+    // <expr>(<expr>, ...) , <expr>++ , <expr>-- , <expr>[<expr>]
+    ExprAST::Ptr parsePostfixExpr();
     // <identifier>, <value>, (<expr>)
     ExprAST::Ptr parsePrimaryExpr();
 
@@ -114,16 +112,18 @@ private:
     FuxType parseType(bool primitive = false);
 
     // parse number with correct type
-    ExprAST::Ptr parseNumberExpr(Token &tok);
+    ExprAST::Ptr parseNumberExpr(const Token &tok);
     // parse char with correct type and escape sequence
-    ExprAST::Ptr parseCharExpr(Token &tok);
+    ExprAST::Ptr parseCharExpr(const Token &tok);
+    // get symbol of identifier (or keyword used as a name)
+    SymbolId getSymbol(const Token &tok);
 
     // get next token
-    Token &eat();
+    Token eat();
     // expect and get next token
-    Token &eat(TokenType type, ParseError::Type = ParseError::UNEXPECTED_TOKEN);
+    Token eat(TokenType type, ParseError::Type = ParseError::UNEXPECTED_TOKEN);
     // peek to Nth token
-    Token &peek(size_t steps = 1);
+    Token peek(int64_t steps = 1);
     // check current token and advance if true
     bool check(TokenType type);
     // check current and next token ...
@@ -135,15 +135,15 @@ private:
     constexpr bool notEOF();
 
     void createError(
-        ParseError::Type type, string title, 
-        const Token &token, string info, size_t ptr = 0, string ptrText = "",
-        vector<string> notes = {}, bool warning = false, bool aggressive = false);
+        ParseError::Type type, string_view title, 
+        const Token &token, string_view info, size_t ptr = 0, string_view ptrText = "",
+        const vector<string> &notes = {}, bool warning = false, bool aggressive = false);
     
     void createError(
-        ParseError::Type type, string title,
-        const Token &token, string info, 
-        const Token &refTok, string refInfo,
-        vector<string> notes = {}, bool warning = false, bool aggressive = true);
+        ParseError::Type type, string_view title,
+        const Token &token, string_view info, 
+        const Token &refTok, string_view refInfo,
+        const vector<string> &notes = {}, bool warning = false, bool aggressive = true);
 
     void debugPrint(const string message);
 };
\ No newline at end of file
@@ -0,0 +1,124 @@
+/**
+ * @file ranges.cpp
+ * @author fuechs
+ * @brief fux parser parallel top-level parsing
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "parser.hpp"
+#include "../ast/visitor.hpp"
+#include "../../util/threading.hpp"
+
+// moves the size ids of the array types in a range behind the ones of the ranges before
+class SizeShift : public ASTVisitor<SizeShift> {
+public:
+    SizeShift(size_t base) : base(base) {}
+
+    void visitTypeCastExpr(TypeCastExprAST &node) { shift(node.type); visitChildren(node); }
+    void visitVariableDecl(VariableDeclAST &node) { shift(node.type); visitChildren(node); }
+    void visitPrototype(PrototypeAST &node) { shift(node.type); visitChildren(node); }
+
+    void visitFunction(FunctionAST &function) {
+        // lazy bodies are not parsed yet, they get the size ids of the file then
+        visit(function.proto);
+        for (StmtAST::Ptr &local : function.locals)
+            visit(local);
+        visit(function.body);
+    }
+
+private:
+    void shift(FuxType &type) {
+        if (type->sizeID > -1)
+            type = FuxType(type->kind, type->pointerDepth, type->access, type->array, type->sizeID + base, type->name);
+    }
+
+    const _i64 base;
+};
+
+vector<size_t> Parser::findRanges(size_t amount) {
+    // a function declaration after a complete top-level statement starts a new range,
+    // nothing before it can continue into it
+    vector<size_t> starts;
+    size_t index = 0;
+    for (;; ++index) {
+        const Token token = current.at(index);
+        if (token == _EOF)
+            break;
+
+        if (token == IDENTIFIER && index > 0 && current.at(index + 1) == LPAREN
+        && (current.at(index - 1) == SEMICOLON || current.at(index - 1) == RBRACE)) {
+            const size_t closing = lexer->partner(index + 1);
+            if (closing != Lexer::noPartner
+            && (current.at(closing + 1) == COLON || current.at(closing + 1) == POINTER))
+                starts.push_back(index);
+        }
+
+        // skip everything between brackets
+        if (token != LPAREN && token != LBRACE && token != LBRACKET)
+            continue;
+        const size_t partner = lexer->partner(index);
+        if (partner != Lexer::noPartner)
+            index = partner;
+    }
+
+    // spread the ranges evenly over the tokens
+    vector<size_t> ranges = {0};
+    for (const size_t &start : starts)
+        if (start >= ranges.size() * index / amount)
+            ranges.push_back(start);
+    ranges.push_back(index);
+    return ranges;
+}
+
+bool Parser::parseRanges(size_t amount) {
+    const vector<size_t> ranges = findRanges(amount);
+    const size_t count = ranges.size() - 1;
+    if (count < 2)
+        return false;
+
+    vector<Parser *> parsers = vector<Parser *>(count);
+    vector<Arena *> arenas = vector<Arena *>(count);
+    vector<RootAST::Ptr> roots = vector<RootAST::Ptr>(count);
+    fuxThread::TaskGroup group;
+    for (size_t i = 0; i < count; i++) {
+        // nodes are allocated from an arena per task, which the current one adopts
+        arenas[i] = Arena::current ? new Arena() : nullptr;
+        ErrorManager *errors = new ErrorManager(true);
+        errors->addSourceFile(fileName, lexer->getBuffer());
+        group.run([&, i, errors] {
+            Arena::Scope scope(arenas[i]);
+            parsers[i] = new Parser(*this, errors, ranges[i], ranges[i + 1]);
+            parsers[i]->parseProgram();
+            roots[i] = std::move(parsers[i]->root);
+        }, fuxThread::ThreadPool::HIGH);
+    }
+    group.wait();
+
+    // the diagnostics and the ast are the same as when parsing serially
+    // unless the parser of the file would have read past the end of a range
+    bool serial = false;
+    for (size_t i = 0; i + 1 < count; i++)
+        serial |= parsers[i]->endedInError;
+
+    for (size_t i = 0; i < count; i++) {
+        if (arenas[i])
+            Arena::current->adopt(arenas[i]);
+        if (serial)
+            continue;
+        error->adopt(parsers[i]->error);
+        if (const size_t base = root->countSizeExprs())
+            SizeShift(base).visit(roots[i]);
+        root->append(*roots[i]);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        roots[i].reset();
+        delete parsers[i]->error;
+        delete parsers[i];
+    }
+    return !serial;
+}
\ No newline at end of file
@@ -11,106 +11,108 @@
 
 #include "type.hpp"
 
-FuxType::~FuxType() {
-    access.clear();
-    name.clear();
+TypeTable fuxTypes;
+
+FuxType::FuxType(Kind kind, _i64 pointerDepth, AccessMask access, bool array, _i64 sizeID, SymbolId name) {
+    if (kind != CUSTOM)
+        name = SymbolPool::none; // only the kind names other types
+    if (pointerDepth == 0 && access == bit(PUBLIC) && !array && sizeID == -1 && name == SymbolPool::none)
+        typeId = TypeTable::plain(kind);
+    else
+        typeId = fuxTypes.intern({kind, access, array, pointerDepth, sizeID, name});
 }
 
-// FuxType::FuxType(const FuxType &copy) {}
-
-FuxType &FuxType::operator=(const FuxType &copy) {
-    this->kind = copy.kind;
-    this->pointerDepth = copy.pointerDepth;
-    this->access = copy.access;
-    this->name = copy.name;
-    this->array = copy.array;
-    this->sizeID = copy.sizeID;
-    return *this;
+bool FuxType::Info::operator==(const Info &comp) const {
+    return kind == comp.kind && access == comp.access && array == comp.array
+        && pointerDepth == comp.pointerDepth && sizeID == comp.sizeID && name == comp.name;
 }
 
-bool FuxType::operator==(const FuxType &comp) const {
-    return (kind == comp.kind 
-            && access == comp.access 
-            && array == comp.array 
-            /* && sizeID == comp.sizeID (shouldn't be required to be equal as of now)*/ );
-}
+bool FuxType::operator!() const { return fuxTypes[typeId].kind == NO_TYPE; }
 
-bool FuxType::operator!() { return kind == NO_TYPE; }
+bool FuxType::has(Access access) const { return fuxTypes[typeId].access & bit(access); }
+
+FuxType FuxType::with(Access access) const {
+    const Info &info = fuxTypes[typeId];
+    return FuxType(info.kind, info.pointerDepth, info.access | bit(access), info.array, info.sizeID, info.name);
+}
 
-FuxType FuxType::createStd(Kind kind, int64_t pointerDepth, AccessList accessList, string name) {
-    return FuxType(kind, pointerDepth, accessList, false, -1, name);
+FuxType FuxType::createStd(Kind kind, _i64 pointerDepth, AccessMask access, SymbolId name) {
+    return FuxType(kind, pointerDepth, access, false, -1, name);
 }
 
-FuxType FuxType::createRef(Kind kind, AccessList accessList, string name) {
-    return FuxType(kind, -1, accessList, false, -1, name); 
+FuxType FuxType::createRef(Kind kind, AccessMask access, SymbolId name) {
+    return FuxType(kind, -1, access, false, -1, name); 
 }
 
-FuxType FuxType::createArray(Kind kind, int64_t pointerDepth, AccessList accessList, string name, _i64 sizeID) {
-    return FuxType(kind, pointerDepth, accessList, true, sizeID, name);
+FuxType FuxType::createArray(Kind kind, _i64 pointerDepth, AccessMask access, SymbolId name, _i64 sizeID) {
+    return FuxType(kind, pointerDepth, access, true, sizeID, name);
 }
 
-FuxType FuxType::createPrimitive(Kind kind, int64_t pointerDepth, bool array, string name) {
-    return FuxType(kind, pointerDepth, AccessList(), array, -1, name);
+FuxType FuxType::createPrimitive(Kind kind, _i64 pointerDepth, bool array, SymbolId name) {
+    return FuxType(kind, pointerDepth, 0, array, -1, name);
 }
 
 
-string FuxType::accessAsString() {
+string FuxType::accessAsString() const {
     stringstream ss;
 
-    for (Access &a : access)
-        switch (a) {
-            case CONSTANT:  ss << "const "; break;
-            case PUBLIC:    ss << "pub "; break;
-            default:        ss << TokenTypeValue[a] << " "; break;
-        }
+    if (has(PUBLIC))
+        ss << "pub ";
+    for (Access a : {SAFE, INTERN, FINAL, FIXED, ASYNC})
+        if (has(a))
+            ss << TokenTypeValue[a] << " ";
+    if (has(CONSTANT))
+        ss << "const ";
 
     return ss.str();
 }
 
-string FuxType::kindAsString() {
-    switch (kind) {
-        case CUSTOM:    return "'"+name+"'";
+string FuxType::kindAsString() const {
+    const Info &info = fuxTypes[typeId];
+    switch (info.kind) {
+        case CUSTOM:    return "'"+string(fuxSymbols[info.name])+"'";
         case AUTO:      return "auto";
         case NO_TYPE:   return "no_type";
-        default:        return TokenTypeValue[kind];
+        default:        return TokenTypeValue[info.kind];
     }
 }
 
-void FuxType::debugPrint(bool primitive) {
+void FuxType::debugPrint(bool primitive) const {
+    const Info &info = fuxTypes[typeId];
     if (primitive) {
-        if (pointerDepth > 0)
-            for (size_t pd = pointerDepth; pd --> 0;)
+        if (info.pointerDepth > 0)
+            for (size_t pd = info.pointerDepth; pd --> 0;)
                 cout << "*";
         cout << kindAsString();
-        if (array)
+        if (info.array)
             cout << "[]";
         return;
     }
 
-    cout << (pointerDepth == -1 ? " -> " : ": ");
+    cout << (info.pointerDepth == -1 ? " -> " : ": ");
     cout << accessAsString();
 
-    if (pointerDepth > 0) 
-        for (size_t pd = pointerDepth; pd --> 0;)
+    if (info.pointerDepth > 0) 
+        for (size_t pd = info.pointerDepth; pd --> 0;)
             cout << "*";
     
     cout << kindAsString();
     
-    if (array) {
+    if (info.array) {
         cout << "[";
-        if (sizeID > -1)
+        if (info.sizeID > -1)
             cout << SC::UNDERLINE << CC::YELLOW 
-                << sizeID << SC::RESET << CC::DEFAULT;
+                << info.sizeID << SC::RESET << CC::DEFAULT;
         cout << "]";
     }
 }
 
-bool FuxType::valid() {
-    if (std::find(access.begin(), access.end(), INTERN) != access.end() 
-    && std::find(access.begin(), access.end(), SAFE) != access.end())
+bool FuxType::valid() const {
+    const Info &info = fuxTypes[typeId];
+    if (has(INTERN) && has(SAFE))
         return false;
 
-    if (kind == CUSTOM && name.empty())
+    if (info.kind == CUSTOM && info.name == SymbolPool::none)
         return false;
 
     // OUTDATED: arraySize is now sizeID
@@ -120,5 +122,53 @@ bool FuxType::valid() {
     // if (array && !arraySize->analyse(e))
     //      return false;
 
-    return pointerDepth >= -1;
+    return info.pointerDepth >= -1;
+}
+
+TypeTable::TypeTable() : count(0) {
+    for (std::atomic<FuxType::Info *> &chunk : chunks)
+        chunk.store(nullptr, std::memory_order_relaxed);
+    for (const FuxType::Kind &kind : plainKinds)
+        intern({kind, FuxType::bit(FuxType::PUBLIC), false, 0, -1, SymbolPool::none});
+}
+
+TypeTable::~TypeTable() {
+    for (std::atomic<FuxType::Info *> &chunk : chunks)
+        delete [] chunk.load();
+}
+
+TypeId TypeTable::intern(const FuxType::Info &info) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto [it, added] = ids.try_emplace(info, count.load(std::memory_order_relaxed));
+    if (!added)
+        return it->second;
+
+    const TypeId id = it->second;
+    assert(id != UINT32_MAX && "too many types");
+    const size_t index = (size_t) id + (1 << firstBits);
+    const size_t bit = 63 - __builtin_clzll(index);
+    FuxType::Info *chunk = chunks[bit - firstBits].load(std::memory_order_relaxed);
+    if (!chunk) {
+        chunk = new FuxType::Info[(size_t) 1 << bit];
+        chunks[bit - firstBits].store(chunk, std::memory_order_release);
+    }
+    chunk[index - ((size_t) 1 << bit)] = info;
+    count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+const FuxType::Info &TypeTable::operator[](TypeId id) const {
+    assert(id < size() && "unknown type id");
+    const size_t index = (size_t) id + (1 << firstBits);
+    const size_t bit = 63 - __builtin_clzll(index);
+    return chunks[bit - firstBits].load(std::memory_order_acquire)[index - ((size_t) 1 << bit)];
+}
+
+size_t TypeTable::size() const { return count.load(std::memory_order_acquire); }
+
+size_t TypeTable::Hash::operator()(const FuxType::Info &info) const {
+    size_t value = info.kind;
+    for (const size_t &field : {(size_t) info.access, (size_t) info.array, (size_t) info.pointerDepth, (size_t) info.sizeID, (size_t) info.name})
+        value = (value ^ field) * 1099511628211ull; // fnv-1a over the fields
+    return value;
 }
\ No newline at end of file
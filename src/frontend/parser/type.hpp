@@ -11,10 +11,19 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <unordered_map>
+
 #include "../../fux.hpp"
 #include "../lexer/token.hpp"
 #include "../../backend/llvmheader.hpp"
+#include "../../util/symbols.hpp"
+
+typedef uint32_t TypeId;
 
+// a type is the id of its entry in the type table (fuxTypes),
+// so it is 4 bytes, copies for free and compares as an integer
 class FuxType {
 public:
     // Possible kinds of data types -- Mapped to respective keyword value
@@ -51,52 +60,119 @@ public:
         PUBLIC,                     // read and write access for everyone / everywhere & default (for values too)
     };
 
-    typedef vector<Access> AccessList;
+    // access modifiers as a set of bits (see bit())
+    typedef uint16_t AccessMask;
     typedef vector<FuxType> Vec;
 
-    FuxType(Kind kind = NO_TYPE, int64_t pointerDepth = 0, AccessList accessList = {PUBLIC}, bool array = false, _i64 sizeID = -1, string name = "")
-    : kind(kind), pointerDepth(pointerDepth), access(accessList), array(array), sizeID(sizeID), name(name) {}
-    // FuxType(const FuxType &copy);
-    ~FuxType();
+    // entry of the type table, every distinct one is stored once
+    struct Info {
+        Kind kind;
+        AccessMask access;
+        // is an array type
+        bool array;
+        // -1 --> Reference
+        //  0 --> Value
+        //  N --> Pointer with depth of N 
+        _i64 pointerDepth;
+        // relevant for array types
+        // -1 -> no size
+        //  N -> ID of array size expr stored in RootAST
+        _i64 sizeID;
+        // name of user defined types (none for all other kinds)
+        SymbolId name;
+
+        bool operator==(const Info &comp) const;
+    };
+
+    FuxType(Kind kind = NO_TYPE, _i64 pointerDepth = 0, AccessMask access = bit(PUBLIC), bool array = false, _i64 sizeID = -1, SymbolId name = SymbolPool::none);
+
+    // type with id (from id())
+    static FuxType byId(TypeId id) { FuxType type; type.typeId = id; return type; }
 
-    FuxType &operator=(const FuxType &copy);
-    bool operator==(const FuxType &comp) const;
-    bool operator!();
+    // same id <=> same type
+    bool operator==(const FuxType &comp) const { return typeId == comp.typeId; }
+    bool operator!=(const FuxType &comp) const { return typeId != comp.typeId; }
+    bool operator!() const;
+    const Info *operator->() const;
+
+    TypeId id() const { return typeId; }
+
+    static constexpr AccessMask bit(Access access) { return 1 << (access - SAFE); }
+    bool has(Access access) const;
+    // same type with access added
+    FuxType with(Access access) const;
 
     // shorthand for normal types
-    static FuxType createStd(Kind kind, int64_t pointerDepth = 0, AccessList accessList = {PUBLIC}, string name = "");
+    static FuxType createStd(Kind kind, _i64 pointerDepth = 0, AccessMask access = bit(PUBLIC), SymbolId name = SymbolPool::none);
     // shorthand for reference types
-    static FuxType createRef(Kind kind, AccessList accessList = {PUBLIC}, string name = "");
+    static FuxType createRef(Kind kind, AccessMask access = bit(PUBLIC), SymbolId name = SymbolPool::none);
     // shorthand for array types
-    static FuxType createArray(Kind kind, int64_t pointerDepth = 0, AccessList accessList = {PUBLIC}, string name = "", _i64 sizeID = -1);    
+    static FuxType createArray(Kind kind, _i64 pointerDepth = 0, AccessMask access = bit(PUBLIC), SymbolId name = SymbolPool::none, _i64 sizeID = -1);    
     // shorthand for primitive types (e.g. for values)
-    static FuxType createPrimitive(Kind kind, int64_t pointerDepth = 0, bool array = false, string name = "");
+    static FuxType createPrimitive(Kind kind, _i64 pointerDepth = 0, bool array = false, SymbolId name = SymbolPool::none);
 
-    // return FuxType::AccessList as string
-    string accessAsString();
+    // return FuxType::AccessMask as string
+    string accessAsString() const;
     // return FuxType::Kind as string
-    string kindAsString();
+    string kindAsString() const;
     // output string representation of type
-    void debugPrint(bool primitive = false);
+    void debugPrint(bool primitive = false) const;
 
     // check wether type is valid
-    bool valid();
-    
-    Kind kind;
-    
-    // -1 --> Reference
-    //  0 --> Value
-    //  N --> Pointer with depth of N 
-    _i64 pointerDepth; 
-    // access modifiers
-    AccessList access;
-    // string value of the type
-    // relevant for user defined types and debugPrint()
-    string name;
-    // is an array type
-    bool array; 
-    // relevant for array types
-    // -1 -> no size
-    //  N -> ID of array size expr stored in RootAST
-    _i64 sizeID;
-};
\ No newline at end of file
+    bool valid() const;
+
+private:
+    TypeId typeId;
+};
+
+// every distinct type is stored once and referred to by its id.
+// reading an entry is lock-free, only adding a new type takes a lock;
+// the plain type of every kind (FuxType(kind)) has a fixed id and is never looked up
+class TypeTable {
+public:
+    TypeTable();
+    ~TypeTable();
+
+    TypeTable(const TypeTable &) = delete;
+    TypeTable &operator=(const TypeTable &) = delete;
+
+    // get id of type, adding it if it is new
+    TypeId intern(const FuxType::Info &info);
+    const FuxType::Info &operator[](TypeId id) const;
+    // amount of types
+    size_t size() const;
+
+    // fixed id of FuxType(kind)
+    static constexpr TypeId plain(FuxType::Kind kind) { return plainIds[kind]; }
+
+private:
+    struct Hash { size_t operator()(const FuxType::Info &info) const; };
+
+    static constexpr FuxType::Kind plainKinds[] = {
+        FuxType::NO_TYPE, FuxType::CUSTOM, FuxType::VOID, FuxType::BOOL, 
+        FuxType::I8, FuxType::U8, FuxType::C8, FuxType::I16, FuxType::U16, FuxType::C16, FuxType::F16, 
+        FuxType::I32, FuxType::U32, FuxType::F32, FuxType::I64, FuxType::U64, FuxType::F64, 
+        FuxType::LIT, FuxType::AUTO, // FuxType::VAR == FuxType::LIT
+    };
+    static constexpr std::array<TypeId, FuxType::NO_TYPE + 1> plainIds = [] {
+        std::array<TypeId, FuxType::NO_TYPE + 1> ids = {};
+        for (TypeId id = 0; id < std::size(plainKinds); id++)
+            ids[plainKinds[id]] = id;
+        return ids;
+    }();
+
+    // chunk c holds ids [2^(c+firstBits) - 2^firstBits, 2^(c+firstBits+1) - 2^firstBits)
+    // (see SymbolPool)
+    static constexpr size_t firstBits = 6;
+    static constexpr size_t maxChunks = 32 - firstBits + 1;
+
+    std::atomic<FuxType::Info *> chunks[maxChunks];
+    std::atomic<size_t> count;
+
+    std::mutex mutex;
+    std::unordered_map<FuxType::Info, TypeId, Hash> ids;
+};
+
+extern TypeTable fuxTypes;
+
+inline const FuxType::Info *FuxType::operator->() const { return &fuxTypes[typeId]; }
\ No newline at end of file
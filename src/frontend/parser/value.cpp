@@ -11,14 +11,9 @@
 
 #include "value.hpp"
 
-ValueStruct::~ValueStruct() {
-    if (type.kind == FuxType::LIT)
-        __lit.clear();
-}
-
 #ifdef FUX_BACKEND
-Value *ValueStruct::getLLVMValue(LLVMWrapper *fuxLLVM) {
-    switch (type.kind) {
+Value *ValueStruct::getLLVMValue(LLVMWrapper *fuxLLVM, const LiteralPool *literals) {
+    switch (type->kind) {
         case FuxType::BOOL:     return fuxLLVM->builder->getInt1(__bool);
         case FuxType::I8:       return fuxLLVM->builder->getInt8(__i8);
         case FuxType::U8:       return fuxLLVM->builder->getInt8(__u8);
@@ -33,8 +28,8 @@ Value *ValueStruct::getLLVMValue(LLVMWrapper *fuxLLVM) {
         case FuxType::U64:      return fuxLLVM->builder->getInt64(__u64);
         case FuxType::F64:      return ConstantFP::get(fuxLLVM->builder->getDoubleTy(), __f64);
         case FuxType::LIT:      {
-            Value *globalLiteral = fuxLLVM->builder->CreateGlobalStringPtr(__lit, "literal_");
-            fuxLLVM->values[globalLiteral->getName().str()] = FuxValue::Literal(globalLiteral);
+            Value *globalLiteral = fuxLLVM->builder->CreateGlobalStringPtr((*literals)[__lit], "literal_");
+            fuxLLVM->values[fuxSymbols.intern(globalLiteral->getName().str())] = FuxValue::Literal(globalLiteral);
             return globalLiteral;
         }
         default:                return nullptr;
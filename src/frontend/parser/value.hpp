@@ -14,34 +14,41 @@
 #include "../../backend/llvmheader.hpp"
 #include "../../backend/generator/wrapper.hpp"
 #include "type.hpp"
+#include "../../util/literals.hpp"
 
-// used to represent values within a union
+// used to represent values within a union (16 bytes, copied as they are);
+// string literals are only an offset and a length into the LiteralPool of their file
 struct ValueStruct {
-    ValueStruct(bool value) :   type(FuxType(FuxType::BOOL)), __bool(value) {}
-    ValueStruct(_i8 value) :    type(FuxType(FuxType::I8)),  __i8(value) {}
-    ValueStruct(_u8 value) :    type(FuxType(FuxType::U8)),  __u8(value) {}
-    ValueStruct(_c8 value) :    type(FuxType(FuxType::C8)),  __c8(value) {}
-    ValueStruct(_i16 value) :   type(FuxType(FuxType::I16)), __i16(value) {}
-    ValueStruct(_u16 value) :   type(FuxType(FuxType::U16)), __u16(value) {}
-    ValueStruct(_c16 value) :   type(FuxType(FuxType::C16)), __c16(value) {}
-    ValueStruct(_i32 value) :   type(FuxType(FuxType::I32)), __i32(value) {}
-    ValueStruct(_u32 value) :   type(FuxType(FuxType::U32)), __u32(value) {}
-    ValueStruct(_f32 value) :   type(FuxType(FuxType::F32)), __f32(value) {}
-    ValueStruct(_i64 value) :   type(FuxType(FuxType::I64)), __i64(value) {}
-    ValueStruct(_u64 value) :   type(FuxType(FuxType::U64)), __u64(value) {}
-    ValueStruct(_f64 value) :   type(FuxType(FuxType::F64)), __f64(value) {}
-    ValueStruct(string value) : type(FuxType(FuxType::LIT)), __lit(value) {}
-    
-    ~ValueStruct();
+    ValueStruct(bool value) :   ValueStruct(FuxType(FuxType::BOOL)) { __bool = value; }
+    ValueStruct(_i8 value) :    ValueStruct(FuxType(FuxType::I8))   { __i8 = value; }
+    ValueStruct(_u8 value) :    ValueStruct(FuxType(FuxType::U8))   { __u8 = value; }
+    ValueStruct(_c8 value) :    ValueStruct(FuxType(FuxType::C8))   { __c8 = value; }
+    ValueStruct(_i16 value) :   ValueStruct(FuxType(FuxType::I16))  { __i16 = value; }
+    ValueStruct(_u16 value) :   ValueStruct(FuxType(FuxType::U16))  { __u16 = value; }
+    ValueStruct(_c16 value) :   ValueStruct(FuxType(FuxType::C16))  { __c16 = value; }
+    ValueStruct(_i32 value) :   ValueStruct(FuxType(FuxType::I32))  { __i32 = value; }
+    ValueStruct(_u32 value) :   ValueStruct(FuxType(FuxType::U32))  { __u32 = value; }
+    ValueStruct(_f32 value) :   ValueStruct(FuxType(FuxType::F32))  { __f32 = value; }
+    ValueStruct(_i64 value) :   ValueStruct(FuxType(FuxType::I64))  { __i64 = value; }
+    ValueStruct(_u64 value) :   ValueStruct(FuxType(FuxType::U64))  { __u64 = value; }
+    ValueStruct(_f64 value) :   ValueStruct(FuxType(FuxType::F64))  { __f64 = value; }
+    ValueStruct(LiteralPool::Literal value) : ValueStruct(FuxType(FuxType::LIT)) { __lit = value; }
+    // value of type with the raw bits of the union
+    ValueStruct(FuxType type, _u64 bits = 0) : type(type), unused(0), __u64(bits) {}
+
+    // add the text of a string literal to literals
+    static ValueStruct literal(LiteralPool &literals, string_view text) { return ValueStruct(literals.add(text)); }
 
     #ifdef FUX_BACKEND
-    Value *getLLVMValue(LLVMWrapper* fuxLLVM);
+    // literals: pool of the file for FuxType::LIT
+    Value *getLLVMValue(LLVMWrapper* fuxLLVM, const LiteralPool *literals = nullptr);
     #endif
 
     // output saved value
-    void debugPrint();
+    void debugPrint(const LiteralPool *literals = nullptr);
 
     FuxType type;
+    uint32_t unused;
     union {
         bool    __bool;
         _i8     __i8;
@@ -56,6 +63,8 @@ struct ValueStruct {
         _i64    __i64;
         _u64    __u64;
         _f64    __f64;
-        string  __lit;
+        LiteralPool::Literal __lit;
     };
-};
\ No newline at end of file
+};
+
+static_assert(sizeof(ValueStruct) == 16 && std::is_trivially_copyable_v<ValueStruct>);
\ No newline at end of file
@@ -11,15 +11,21 @@
 
 #pragma once
 
+#include <bit>
 #include <cassert>
+#include <charconv>
+#include <cstring>
 #include <fstream>
+#include <functional>
 #include <future>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -27,7 +33,7 @@
 #include "util/io.hpp"
 
 using std::cout, std::cerr, std::endl, std::exception, std::make_unique,
-        std::map, std::pair, std::reference_wrapper, std::string, std::stringstream, 
+        std::map, std::pair, std::reference_wrapper, std::string, std::string_view, std::stringstream, 
         std::to_string, std::unique_ptr, std::vector;
 
 // #define FUX_BACKEND
@@ -57,13 +63,24 @@ using std::cout, std::cerr, std::endl, std::exception, std::make_unique,
     #define FUX_UNKNOWN_PLATFORM
 #endif
 
+#ifndef FUX_WIN
+    // memory mapped source files
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+class SourceBuffer;
+
 // compiler options / flags
 struct FuxOptions {
 
     ~FuxOptions();
 
     string fileName; // file to compile (main)
-    vector<string> fileLines; // lines of that file (main)
+    const SourceBuffer *fileBuffer = nullptr; // source of that file (main)
+    vector<string> packages; // files parsed together with the main file
     string out              = "a.out"; // output binary file
     string version          = "0.1";
     vector<string> libraries = {
@@ -88,6 +105,7 @@ struct FuxOptions {
     bool debugMode          = true; // ! change to false later
     
     size_t errorLimit     = 1000;
+    size_t jobs           = 0; // workers of the thread pool, 0: one per core
     string target         = ""; 
     // targeted architecture / platform
     // e.g. arm64-apple-darwin22.2.0
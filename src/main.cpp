@@ -13,7 +13,6 @@
 #include "util/source.hpp"
 
 #ifdef FUX_BACKEND
-#include "util/threading.hpp"
 #include "backend/context/context.hpp"
 
 RootAST::Ptr createTestAST();
@@ -59,12 +58,23 @@ int main(int argc, char **argv) {
     SourceFile *mainFile = new SourceFile(error, fux.options.fileName, true);
     fux.options.libraries.push_back(mainFile->fileDir); // add src include path 
 
-    mainFile->parse();
-    RootAST::Ptr root = std::move(mainFile->root);
-    if (mainFile->errors()) {
-        delete mainFile;
+    fuxCancel.reset();
+    SourceFile::Vec files = {mainFile};
+    for (const string &package : fux.options.packages)
+        files.push_back(new SourceFile(new ErrorManager(), package));
+    SourceFile::parse(files);
+    for (SourceFile *file : files)
+        file->cache();
+
+    size_t errors = 0;
+    for (SourceFile *file : files)
+        errors += file->errors();
+    if (errors) {
+        for (SourceFile *file : files)
+            delete file;
         return 1;
     } 
+    RootAST::Ptr root = std::move(mainFile->root);
     root->debugPrint();
 
     // RootAST::Ptr root = createTestAST();    
@@ -137,11 +147,23 @@ int bootstrap(int argc, char **argv) {
         }
         else if (cmp("-debug") || cmp("-d"))    fux.options.debugMode = true;
         else if (cmp("-nothread"))              fux.options.threading = false;
+        else if (cmp("-j")) {
+            if ((i + 1) >= argc) {
+                cerr << "count required after option '-j'\n";
+                return printHelp();
+            }
+            if (atoll(argv[++i]) <= 0) {
+                cerr << "invalid job count '" << string(argv[i]) << "'\n";
+                return printHelp();
+            }
+            fux.options.jobs = (size_t) atoll(argv[i]);
+        }
         else if (cmp("-repl"))                  return -1;
         else if (cmp("-h") || cmp("-help"))     return printHelp();
 
         else if (argv[i][0] == '-')             cerr << "invalid option '"+string(argv[i])+"'\n";
-        else                                    fux.options.fileName = argv[i];
+        else if (fux.options.fileName.empty())  fux.options.fileName = argv[i];
+        else                                    fux.options.packages.push_back(argv[i]);
     }
 
     if (fux.options.fileName.empty()) {   
@@ -154,7 +176,7 @@ int bootstrap(int argc, char **argv) {
 
 int printHelp() {
     cout 
-        << "Usage: fux [options] <source file>\n"
+        << "Usage: fux [options] <source file> [package files]\n"
         << "[options]\n\n"
         << "    -V                  print version and exit\n"
         << "    -o <file>           set output object file name\n"
@@ -173,6 +195,7 @@ int printHelp() {
         << "    -release -r         generate a release build\n"
         << "    -debug -d           turn debug mode on\n"
         << "    -nothread           deactivate multihreading for parsing\n"
+        << "    -j <count>          set the amount of worker threads\n"
         << "    -repl               start repl\n"
         << "    -h -help            show this message and exit"
         << endl;
@@ -203,14 +226,17 @@ int repl() {
         else if (input == "exit" || input == "exit;")
             break;
 
+        fuxCancel.reset(); // errors of the previous input don't stop this one
         ErrorManager *error = new ErrorManager();
         string streamName = "<stdin>";
-        error->addSourceFile(streamName, {input});
-        Parser *parser = new Parser(error, "<stdin>", input, true);
+        SourceBuffer *buffer = SourceBuffer::fromString(input);
+        Parser *parser = new Parser(error, streamName, buffer, true);
         RootAST::Ptr root = parser->parse();
+        error->report();
         // Analyser *analyser = new Analyser(error, root);
         // StmtAST::Ptr analysed = analyser->analyse();
         delete parser;
+        delete buffer;
         // delete analyser;
 
         if (!error->errors())  {          
@@ -230,8 +256,8 @@ RootAST::Ptr createTestAST() {
 
     // modify(num -> i64): void;
     StmtAST::Vec eArgs = StmtAST::Vec();
-    eArgs.push_back(make_unique<VariableDeclAST>("num", FuxType::createRef(FuxType::I64)));
-    StmtAST::Ptr emptyF = make_unique<PrototypeAST>(FuxType(FuxType::VOID), "modify", eArgs);
+    eArgs.push_back(make_unique<VariableDeclAST>(fuxSymbols.intern("num"), FuxType::createRef(FuxType::I64)));
+    StmtAST::Ptr emptyF = make_unique<PrototypeAST>(FuxType(FuxType::VOID), fuxSymbols.intern("modify"), eArgs);
     root->addSub(emptyF);
 
     // main(argc: i64, argv: str[]): i64 {
@@ -240,31 +266,31 @@ RootAST::Ptr createTestAST() {
     //      return x;
     // }
     StmtAST::Vec args = StmtAST::Vec();
-    args.push_back(make_unique<VariableDeclAST>("argc", FuxType::createStd(FuxType::U64, 0, {FuxType::FINAL})));
-    args.push_back(make_unique<VariableDeclAST>("argv", FuxType::createArray(FuxType::LIT, 0, {FuxType::FINAL})));
+    args.push_back(make_unique<VariableDeclAST>(fuxSymbols.intern("argc"), FuxType::createStd(FuxType::U64, 0, FuxType::bit(FuxType::FINAL))));
+    args.push_back(make_unique<VariableDeclAST>(fuxSymbols.intern("argv"), FuxType::createArray(FuxType::LIT, 0, FuxType::bit(FuxType::FINAL))));
 
     StmtAST::Vec bodyList = StmtAST::Vec();
     
-    ExprAST::Ptr variable = make_unique<VariableExprAST>("argc");
+    ExprAST::Ptr variable = make_unique<VariableExprAST>(fuxSymbols.intern("argc"));
     ExprAST::Ptr constant = make_unique<NumberExprAST, _i64>(1);
     ExprAST::Ptr binop = make_unique<BinaryExprAST>(BinaryOp::ADD, variable, constant);
-    StmtAST::Ptr decl = make_unique<VariableDeclAST>("x", FuxType(FuxType::I64), binop);
+    StmtAST::Ptr decl = make_unique<VariableDeclAST>(fuxSymbols.intern("x"), FuxType(FuxType::I64), binop);
     bodyList.push_back(std::move(decl));
 
-    variable = make_unique<VariableExprAST>("x");
+    variable = make_unique<VariableExprAST>(fuxSymbols.intern("x"));
     ExprAST::Vec pass = ExprAST::Vec();
     pass.push_back(std::move(variable));
-    StmtAST::Ptr call = make_unique<CallExprAST>("modify", pass);
+    StmtAST::Ptr call = make_unique<CallExprAST>(fuxSymbols.intern("modify"), pass);
     bodyList.push_back(std::move(call));
 
-    variable = make_unique<VariableExprAST>("x");
+    variable = make_unique<VariableExprAST>(fuxSymbols.intern("x"));
     ExprAST::Vec retArgs = ExprAST::Vec();
     retArgs.push_back(std::move(variable));
     StmtAST::Ptr ret = make_unique<InbuiltCallAST>(Inbuilts::RETURN, retArgs);
     bodyList.push_back(std::move(ret));
 
     StmtAST::Ptr body = make_unique<CodeBlockAST>(bodyList);
-    FunctionAST::Ptr mFunc = make_unique<FunctionAST>(FuxType(FuxType::I64), "main", args);
+    FunctionAST::Ptr mFunc = make_unique<FunctionAST>(FuxType(FuxType::I64), fuxSymbols.intern("main"), args);
     mFunc->setBody(body);
     StmtAST::Ptr _mFunc = std::move(mFunc);
     root->addSub(_mFunc); 
@@ -285,7 +311,7 @@ void clearConsole() {
 
 FuxOptions::~FuxOptions() { 
     fileName.clear();
-    fileLines.clear();
+    packages.clear();
     out.clear(); 
     version.clear();
     libraries.clear();
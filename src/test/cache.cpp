@@ -0,0 +1,132 @@
+/**
+ * @file cache.cpp
+ * @author fuechs
+ * @brief fux ast cache test
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include <set>
+
+#include "../frontend/parser/parser.hpp"
+#include "../frontend/ast/cache.hpp"
+#include "../frontend/ast/flat.hpp"
+#include "../bench/bench.hpp"
+
+FuxStruct fux;
+
+FuxOptions::~FuxOptions() {}
+
+// characters that don't change the amount of lines
+static const char letters[] = "abcdefghijklmnopqrstuvwxyz0123456789 ;:=+-*/(){}[]";
+
+bool same(const FlatAST &a, const FlatAST &b) {
+    if (a.nodes.size() != b.nodes.size() || a.values.size() != b.values.size())
+        return false;
+    for (size_t i = 0; i < a.nodes.size(); i++) {
+        const FlatAST::Node &x = a.nodes[i], &y = b.nodes[i];
+        if (x.kind != y.kind || x.op != y.op || x.flags != y.flags || x.size != y.size || x.data != y.data || x.type != y.type)
+            return false;
+    }
+    for (size_t i = 0; i < a.values.size(); i++)
+        if (a.values[i].type.id() != b.values[i].type.id() || a.values[i].__u64 != b.values[i].__u64)
+            return false;
+    return true;
+}
+
+// write the cache of source, which has to give the same tree again,
+// then edit it without changing its size or lines: the cache has to be stale for every edited source
+// returns the amount of edited sources that still loaded the cache
+size_t test(const string &name, const string &source, size_t edits, std::mt19937 &rng) {
+    const string path = "test-" + ASTCache::path(name);
+    SourceBuffer *buffer = SourceBuffer::fromString(source);
+    ErrorManager error = ErrorManager(true);
+    Arena arena;
+    Arena::Scope scope(&arena);
+    RootAST::Ptr root = Parser(&error, name, buffer).parse();
+    const FlatAST flat = FlatAST(*root);
+    size_t failures = 0;
+
+    FlatAST loaded;
+    if (!ASTCache::write(path, flat, *buffer, name) || !ASTCache::read(path, *buffer, loaded)) {
+        cerr << name << ": could not write and read the cache\n";
+        delete buffer;
+        return 1;
+    }
+    if (!same(flat, FlatAST(*loaded.tree()))) {
+        cerr << name << ": the tree built from the cache differs from the parsed one\n";
+        ++failures;
+    }
+
+    for (size_t i = 0; i < edits; i++) {
+        string edited = source;
+        const size_t offset = rng() % source.size();
+        const size_t length = std::min<size_t>(1 + rng() % 8, source.size() - offset);
+        for (size_t k = 0; k < length; k++)
+            if (edited[offset + k] != '\n')
+                edited[offset + k] = letters[rng() % (sizeof(letters) - 1)];
+        if (edited == source)
+            continue;
+
+        SourceBuffer *changed = SourceBuffer::fromString(edited);
+        if (ASTCache::read(path, *changed, loaded)) {
+            cerr << name << ": edit " << i << " at " << offset << " (" << length << " bytes) loaded the stale cache\n";
+            ++failures;
+        }
+        delete changed;
+    }
+
+    std::remove(path.c_str());
+    delete buffer;
+    return failures;
+}
+
+// every pair of letters at two offsets of one word apart (high bytes of the words)
+// has to give a different hash
+size_t testPairs(const string &source) {
+    std::set<uint64_t> hashes;
+    string edited = source;
+    for (char first = 'a'; first <= 'z'; first++)
+        for (char second = 'a'; second <= 'z'; second++) {
+            edited[7] = first;
+            edited[15] = second;
+            hashes.insert(ASTCache::hash(edited));
+        }
+    if (hashes.size() == 26 * 26)
+        return 0;
+    cerr << "pairs: " << hashes.size() << " different hashes for " << 26 * 26 << " sources\n";
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    size_t size = 16 * 1024;
+    size_t edits = 2000;
+    uint32_t seed = 7;
+
+    for (int i = 1; i < argc; i++) {
+        const string arg = argv[i];
+        if (arg == "-size" && i + 1 < argc)             size = std::stoull(argv[++i]) * 1024;
+        else if (arg == "-edits" && i + 1 < argc)       edits = std::stoull(argv[++i]);
+        else if (arg == "-seed" && i + 1 < argc)        seed = std::stoul(argv[++i]);
+        else {
+            cerr << "usage: " << argv[0] << " [-size <KB>] [-edits <n>] [-seed <n>]\n";
+            return 1;
+        }
+    }
+
+    fux.options.debugMode = false;
+    std::mt19937 rng(seed);
+    size_t failures = testPairs("main():di64 { xx:= 0; return xx; }\n");
+    for (const Corpus &corpus : generateCorpora(size))
+        failures += test(corpus.name + ".fux", corpus.source, edits, rng);
+
+    if (failures) {
+        cerr << "cache: " << failures << " failures (seed " << seed << ")\n";
+        return 1;
+    }
+    cout << "cache: ok\n";
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+/**
+ * @file chunks.cpp
+ * @author fuechs
+ * @brief fux parallel lexing test
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "../frontend/lexer/lexer.hpp"
+#include "../bench/bench.hpp"
+
+FuxStruct fux;
+
+FuxOptions::~FuxOptions() {}
+
+// comments and literals that hide what looks like code (or span lines),
+// so a chunk that starts inside of them is lexed wrong;
+// broken literals make findChunks() guess wrong, so chunks are lexed again
+static const char *pieces[] = {
+    "/* a block comment\n   over three\n   lines with \"quotes\" and // slashes */",
+    "/* /* is not nested */",
+    "// a line comment with /* and \" in it\n",
+    "#! a shebang comment\n",
+    "\"a string with \\\" escaped quotes and // no comment\"",
+    "\"a string /* not a comment */ with a\\nnewline escape\"",
+    "\"an unterminated string\n",
+    "'\\''", "'\"'", "'/'", "'\\n'", "'*'", "'ab'", "'", "\"", "\"ends with a backslash\\\n",
+    "x = 12_345 + 0xff * 1.5e3 - 99999999999;", "values[7] << \"text\";", "a: i64 = 'c';",
+    "\n", "\n\n", " ", "    ", "{", "}", "(", ")", "[", "]", ";",
+};
+
+bool same(const Lexer &serial, const Token &expected, const Lexer &parallel, const Token &token) {
+    return expected.type == token.type && expected.offset == token.offset
+        && expected.length == token.length && expected.line == token.line
+        && (expected.isNumber() ? serial.number(expected) == parallel.number(token) : expected.payload == token.payload);
+}
+
+// lex source in chunks and serially, the tokens, bracket partners and errors have to be the same
+// returns 1 on a mismatch
+size_t test(const string &name, const string &source) {
+    SourceBuffer *buffer = SourceBuffer::fromString(source);
+
+    ErrorManager *parallelError = new ErrorManager(true);
+    Lexer *parallel = new Lexer(buffer, name, parallelError);
+    if (parallel->chunks() < 2) {
+        cerr << name << ": too small to be lexed in chunks\n";
+        delete parallel;
+        delete parallelError;
+        delete buffer;
+        return 1;
+    }
+    const Token::Vec &tokens = parallel->lex();
+
+    fux.options.threading = false;
+    ErrorManager *serialError = new ErrorManager(true);
+    Lexer *serial = new Lexer(buffer, name, serialError);
+    const Token::Vec &expected = serial->lex();
+    fux.options.threading = true;
+
+    size_t index = 0;
+    while (index < expected.size() && index < tokens.size() && same(*serial, expected[index], *parallel, tokens[index])
+        && serial->partner(index) == parallel->partner(index))
+        ++index;
+
+    size_t mismatches = 0;
+    if (index < expected.size() || index < tokens.size()) {
+        cerr << name << ": token " << index << " differs (" << tokens.size() << " tokens, expected " << expected.size() << ")\n";
+        ++mismatches;
+    } else if (parallelError->errors() != serialError->errors()) {
+        cerr << name << ": " << parallelError->errors() << " errors, expected " << serialError->errors() << "\n";
+        ++mismatches;
+    }
+
+    delete parallel;
+    delete parallelError;
+    delete serial;
+    delete serialError;
+    delete buffer;
+    return mismatches;
+}
+
+int main(int argc, char **argv) {
+    size_t size = 4 * 1024;
+    size_t sources = 200;
+    uint32_t seed = 7;
+
+    for (int i = 1; i < argc; i++) {
+        const string arg = argv[i];
+        if (arg == "-size" && i + 1 < argc)             size = std::stoull(argv[++i]) * 1024;
+        else if (arg == "-sources" && i + 1 < argc)     sources = std::stoull(argv[++i]);
+        else if (arg == "-seed" && i + 1 < argc)        seed = std::stoul(argv[++i]);
+        else {
+            cerr << "usage: " << argv[0] << " [-size <KB>] [-sources <n>] [-seed <n>]\n";
+            return 1;
+        }
+    }
+
+    // small chunks, so every source is split many times
+    fux.options.debugMode = false;
+    fux.options.jobs = 4;
+    Lexer::minChunkSize = 256;
+    std::mt19937 rng(seed);
+    size_t mismatches = 0;
+
+    for (size_t i = 0; i < sources; i++) {
+        string source;
+        while (source.size() < size)
+            source += pieces[rng() % (sizeof(pieces) / sizeof(*pieces))];
+        mismatches += test("source" + to_string(i) + ".fux", source);
+    }
+    for (const Corpus &corpus : generateCorpora(size))
+        mismatches += test(corpus.name + ".fux", corpus.source);
+
+    if (mismatches) {
+        cerr << "chunks: " << mismatches << " mismatches (seed " << seed << ")\n";
+        return 1;
+    }
+    cout << "chunks: ok\n";
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+/**
+ * @file numbers.cpp
+ * @author fuechs
+ * @brief fux number literal test
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "../frontend/lexer/lexer.hpp"
+
+FuxStruct fux;
+
+FuxOptions::~FuxOptions() {}
+
+struct Case {
+    const char *source;
+    TokenType type;
+    uint64_t value;
+    bool fits = true; // false: "Number too large" and any value
+};
+
+static uint64_t bits(double value) { return std::bit_cast<uint64_t>(value); }
+
+static const Case cases[] = {
+    {"0",                       NUMBER,         0},
+    {"42",                      NUMBER,         42},
+    {"1_000",                   NUMBER,         1000},
+    {"1e3",                     NUMBER,         1000}, // the exponent counts (it was ignored before, giving 1)
+    {"1E3",                     NUMBER,         1000},
+    {"1e+2",                    NUMBER,         100},
+    {"25e-1",                   NUMBER,         2},
+    {"0e30",                    NUMBER,         0},
+    {"18446744073709551615",    NUMBER,         UINT64_MAX},
+    {"18446744073709551616",    NUMBER,         0, false},
+    {"2e19",                    NUMBER,         0, false},
+    {"0x0",                     HEXADECIMAL,    0},
+    {"0xff",                    HEXADECIMAL,    255},
+    {"0xDead_Beef",             HEXADECIMAL,    0xdeadbeef},
+    {"0xffff_ffff_ffff_ffff",   HEXADECIMAL,    UINT64_MAX},
+    {"0x1_0000_0000_0000_0000", HEXADECIMAL,    0, false},
+    {"0o17",                    OCTAL,          15},
+    {"0o1777777777777777777777", OCTAL,         UINT64_MAX},
+    {"0b101",                   BINARY,         5},
+    {"0b1111_0000",             BINARY,         240},
+    {"1.5",                     FLOAT,          bits(1.5)},
+    {"0.1",                     FLOAT,          bits(0.1)},
+    {"1_0.2_5",                 FLOAT,          bits(10.25)},
+    {"1.5e3",                   FLOAT,          bits(1500.0)},
+    {"2.5e-1",                  FLOAT,          bits(0.25)},
+    {"1.0e400",                 FLOAT,          0, false},
+};
+
+// lex the literal alone and compare its type, value and errors
+bool test(const Case &expected) {
+    SourceBuffer *buffer = SourceBuffer::fromString(expected.source);
+    ErrorManager *error = new ErrorManager(true);
+    Lexer *lexer = new Lexer(buffer, "numbers.fux", error);
+    const Token::Vec &tokens = lexer->lex();
+
+    bool passed = !tokens.empty() && tokens[0].type == expected.type && tokens[0].length == strlen(expected.source)
+        && (expected.fits ? !error->errors() && lexer->number(tokens[0]) == expected.value : error->errors() == 1);
+    if (!passed) {
+        cerr << "'" << expected.source << "': expected " << TokenTypeString[expected.type] << " ";
+        if (expected.fits)
+            cerr << expected.value;
+        else
+            cerr << "(too large)";
+        if (tokens.empty())
+            cerr << ", got no token\n";
+        else
+            cerr << ", got " << TokenTypeString[tokens[0].type] << " " << (tokens[0].isNumber() ? lexer->number(tokens[0]) : 0)
+                 << " with " << error->errors() << " errors\n";
+    }
+
+    delete lexer;
+    delete error;
+    delete buffer;
+    return passed;
+}
+
+int main() {
+    fux.options.debugMode = false;
+    size_t failures = 0;
+    for (const Case &expected : cases)
+        failures += !test(expected);
+
+    if (failures) {
+        cerr << "numbers: " << failures << " failures\n";
+        return 1;
+    }
+    cout << "numbers: ok\n";
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+/**
+ * @file relex.cpp
+ * @author fuechs
+ * @brief fux incremental lexing test
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "../frontend/lexer/lexer.hpp"
+#include "../bench/bench.hpp"
+
+FuxStruct fux;
+
+FuxOptions::~FuxOptions() {}
+
+// snippets that change how the text around them is lexed
+static const char *snippets[] = {
+    "", " ", "\n", "\n\n", "/*", "*/", "//", "#", "\"", "'", "\\", "'a'",
+    "x", "abc def", "12", ".5", "1.5", "7e3", "0x_f", "99999999999999999999",
+    "+", "-", "=", "<", "|", ">", ".", "(", ")", "{", "}", "[", "]", ";",
+};
+
+bool same(const Lexer &full, const Token &expected, const Lexer &incremental, const Token &token) {
+    return expected.type == token.type && expected.offset == token.offset
+        && expected.length == token.length && expected.line == token.line
+        && (expected.isNumber() ? full.number(expected) == incremental.number(token) : expected.payload == token.payload);
+}
+
+// apply random edits to source one after another,
+// relex the tokens of the previous source and compare them to lexing the edited source
+// returns the amount of mismatches
+size_t test(const string &name, const string &source, size_t edits, std::mt19937 &rng) {
+    SourceBuffer *buffer = SourceBuffer::fromString(source);
+    ErrorManager *error = new ErrorManager(true);
+    Lexer *lexer = new Lexer(buffer, name, error);
+    Token::Vec previous = lexer->lex();
+    size_t mismatches = 0;
+
+    for (size_t i = 0; i < edits; i++) {
+        const size_t offset = rng() % (buffer->size() + 1);
+        const size_t removed = std::min<size_t>(rng() % 8, buffer->size() - offset);
+        string inserted;
+        for (size_t k = rng() % 4; k > 0; k--)
+            inserted += snippets[rng() % (sizeof(snippets) / sizeof(*snippets))];
+        SourceBuffer *edited = buffer->edit(offset, removed, inserted);
+
+        ErrorManager fullError = ErrorManager(true);
+        Lexer full = Lexer(edited, name, &fullError);
+        const Token::Vec &expected = full.lex();
+
+        ErrorManager *incrementalError = new ErrorManager(true);
+        Lexer *incremental = new Lexer(edited, name, incrementalError);
+        const Token::Vec &tokens = incremental->relex(previous, offset, removed, inserted);
+
+        size_t index = 0;
+        while (index < expected.size() && index < tokens.size() && same(full, expected[index], *incremental, tokens[index]))
+            ++index;
+        const bool mismatch = index < expected.size() || index < tokens.size();
+        if (mismatch) {
+            cerr << name << ": edit " << i << " at " << offset << " (removed " << removed
+                 << ", inserted '" << inserted << "'): token " << index << " differs\n";
+            ++mismatches;
+        }
+
+        // the next edit applies to the edited source
+        // (continue with the right tokens, so one mismatch doesn't cause the next ones)
+        previous = mismatch ? expected : tokens;
+        delete lexer;
+        delete error;
+        delete buffer;
+        lexer = incremental;
+        error = incrementalError;
+        buffer = edited;
+    }
+
+    delete lexer;
+    delete error;
+    delete buffer;
+    return mismatches;
+}
+
+int main(int argc, char **argv) {
+    size_t size = 16 * 1024;
+    size_t edits = 2000;
+    uint32_t seed = 7;
+
+    for (int i = 1; i < argc; i++) {
+        const string arg = argv[i];
+        if (arg == "-size" && i + 1 < argc)             size = std::stoull(argv[++i]) * 1024;
+        else if (arg == "-edits" && i + 1 < argc)       edits = std::stoull(argv[++i]);
+        else if (arg == "-seed" && i + 1 < argc)        seed = std::stoul(argv[++i]);
+        else {
+            cerr << "usage: " << argv[0] << " [-size <KB>] [-edits <n>] [-seed <n>]\n";
+            return 1;
+        }
+    }
+
+    fux.options.debugMode = false;
+    std::mt19937 rng(seed);
+    size_t mismatches = 0;
+    for (const Corpus &corpus : generateCorpora(size))
+        mismatches += test(corpus.name + ".fux", corpus.source, edits, rng);
+
+    if (mismatches) {
+        cerr << "relex: " << mismatches << " mismatches (seed " << seed << ")\n";
+        return 1;
+    }
+    cout << "relex: ok\n";
+    return 0;
+}
\ No newline at end of file
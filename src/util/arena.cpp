@@ -0,0 +1,80 @@
+/**
+ * @file arena.cpp
+ * @author fuechs
+ * @brief fux arena allocator
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "arena.hpp"
+
+thread_local Arena *Arena::current = nullptr;
+
+Arena::Arena(size_t blockSize)
+: blockSize(blockSize), blocks(), adopted(), pointer(nullptr), end(nullptr), used(0) {}
+
+Arena::~Arena() {
+    for (auto it = finalizers.rbegin(); it != finalizers.rend(); ++it)
+        it->second(it->first);
+    for (char *block : blocks)
+        ::operator delete(block);
+    for (Arena *arena : adopted)
+        delete arena;
+}
+
+void *Arena::allocate(size_t size, size_t align) {
+    assert(!busy.exchange(true) && "an arena is used by two threads at once");
+    char *aligned = (char *) (((uintptr_t) pointer + align - 1) & ~(uintptr_t) (align - 1));
+    if (!pointer || aligned + size > end) {
+        grow(size + align);
+        aligned = (char *) (((uintptr_t) pointer + align - 1) & ~(uintptr_t) (align - 1));
+    }
+    pointer = aligned + size;
+    used += size;
+    #ifndef NDEBUG
+    busy = false;
+    #endif
+    return aligned;
+}
+
+size_t Arena::size() const {
+    size_t size = used;
+    for (Arena *arena : adopted)
+        size += arena->size();
+    return size;
+}
+
+// containers keep pointers to the arena they allocate from,
+// so the other arena has to stay alive instead of giving its blocks away
+void Arena::adopt(Arena *other) { adopted.push_back(other); }
+
+void *Arena::create(size_t size) {
+    Header *header;
+    if (current)
+        header = static_cast<Header *>(current->allocate(sizeof(Header) + size, alignof(Header)));
+    else
+        header = static_cast<Header *>(::operator new(sizeof(Header) + size));
+    header->arena = current;
+    return header + 1;
+}
+
+void Arena::release(void *ptr) {
+    if (!ptr)
+        return;
+    Header *header = static_cast<Header *>(ptr) - 1;
+    if (!header->arena)
+        ::operator delete(header);
+}
+
+Arena *Arena::owner(const void *ptr) { return (static_cast<const Header *>(ptr) - 1)->arena; }
+
+void Arena::grow(size_t size) {
+    // oversized requests get a block of their own
+    const size_t length = std::max(size, blockSize);
+    blocks.push_back(static_cast<char *>(::operator new(length)));
+    pointer = blocks.back();
+    end = pointer + length;
+}
\ No newline at end of file
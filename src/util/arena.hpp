@@ -0,0 +1,110 @@
+/**
+ * @file arena.hpp
+ * @author fuechs
+ * @brief fux arena allocator header
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "../fux.hpp"
+
+// bump-pointer allocator; memory is only released all at once
+// when the arena is destroyed. not thread-safe: only one thread may
+// allocate from an arena at a time (asserted in debug builds),
+// every thread allocates from its own current arena (see Arena::Scope)
+class Arena {
+public:
+    Arena(size_t blockSize = 64 * 1024);
+    ~Arena();
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    void *allocate(size_t size, size_t align = alignof(std::max_align_t));
+    // amount of bytes handed out (including adopted arenas)
+    size_t size() const;
+    // take ownership of an arena another thread allocated from,
+    // it is destroyed together with this one
+    void adopt(Arena *other);
+
+    // allocate from the current arena of this thread or the heap;
+    // release() only frees what came from the heap
+    static void *create(size_t size);
+    static void release(void *ptr);
+    // arena ptr (from create()) was allocated from, nullptr for the heap
+    static Arena *owner(const void *ptr);
+
+    // destroy object together with the arena; for members of objects in the arena
+    // that own memory elsewhere, since the objects themselves are never destroyed
+    template<typename T>
+    void finalize(T *object) { 
+        finalizers.push_back({object, [](void *object) { static_cast<T *>(object)->~T(); }}); 
+    }
+
+    // makes an arena the current one of this thread while in scope
+    class Scope {
+    public:
+        Scope(Arena *arena) : previous(current) { current = arena; }
+        ~Scope() { current = previous; }
+
+    private:
+        Arena *previous;
+    };
+
+    // std allocator for containers owned by arena allocated objects
+    template<typename T>
+    class Allocator {
+    public:
+        typedef T value_type;
+        typedef std::true_type propagate_on_container_copy_assignment;
+        typedef std::true_type propagate_on_container_move_assignment;
+        typedef std::true_type propagate_on_container_swap;
+
+        Allocator() : arena(current) {}
+        template<typename U>
+        Allocator(const Allocator<U> &other) : arena(other.arena) {}
+
+        T *allocate(size_t n) {
+            if (arena)
+                return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T *ptr, size_t n) {
+            if (!arena)
+                std::allocator<T>().deallocate(ptr, n);
+        }
+
+        template<typename U>
+        bool operator==(const Allocator<U> &other) const { return arena == other.arena; }
+
+        Arena *arena;
+    };
+
+    static thread_local Arena *current;
+
+private:
+    // placed in front of everything create() returns
+    struct alignas(std::max_align_t) Header {
+        Arena *arena;
+    };
+
+    void grow(size_t size);
+
+    size_t blockSize;
+    vector<char *> blocks;
+    vector<Arena *> adopted;
+    vector<std::pair<void *, void (*)(void *)>> finalizers;
+    std::atomic<bool> busy = false; // debug builds: a thread is allocating
+    char *pointer;
+    char *end;
+    size_t used;
+};
\ No newline at end of file
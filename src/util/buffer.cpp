@@ -0,0 +1,114 @@
+/**
+ * @file buffer.cpp
+ * @author fuechs
+ * @brief fux source buffer
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ * 
+ */
+
+#include "buffer.hpp"
+
+// tokens and the line table store offsets in 32 bits
+static void checkSize(const string &path, uint64_t size) {
+    if (size <= UINT32_MAX)
+        return;
+    cerr << "file '" << path << "' is too large (" << size << " bytes, at most " << UINT32_MAX << ")\n";
+    exit(1);
+}
+
+SourceBuffer *SourceBuffer::open(const string &path) {
+    SourceBuffer *buffer = new SourceBuffer();
+
+    #ifndef FUX_WIN
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        cerr << "could not open file '" << path << "'\n";
+        exit(1);
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        checkSize(path, info.st_size);
+        void *mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            madvise(mapping, info.st_size, MADV_SEQUENTIAL);
+            buffer->begin = (const char *) mapping;
+            buffer->length = info.st_size;
+            buffer->mapped = true;
+        }
+    }
+    close(fd);
+    #endif
+
+    if (!buffer->mapped) { // empty file, pipe or no mmap available
+        buffer->owned = readFile(path);
+        checkSize(path, buffer->owned.size());
+        buffer->begin = buffer->owned.data();
+        buffer->length = buffer->owned.size();
+    }
+
+    buffer->indexLines();
+    return buffer;
+}
+
+SourceBuffer *SourceBuffer::fromString(const string &contents) {
+    SourceBuffer *buffer = new SourceBuffer();
+    buffer->owned = contents;
+    buffer->begin = buffer->owned.data();
+    buffer->length = buffer->owned.size();
+    buffer->indexLines();
+    return buffer;
+}
+
+SourceBuffer *SourceBuffer::edit(size_t offset, size_t removed, string_view inserted) const {
+    assert(offset + removed <= length && "edit is out of range");
+    string contents;
+    contents.reserve(length - removed + inserted.length());
+    contents.append(begin, offset);
+    contents.append(inserted);
+    contents.append(begin + offset + removed, length - offset - removed);
+    return fromString(contents);
+}
+
+SourceBuffer::~SourceBuffer() {
+    #ifndef FUX_WIN
+    if (mapped)
+        munmap((void *) begin, length);
+    #endif
+    owned.clear();
+    lineTable.clear();
+}
+
+string_view SourceBuffer::line(size_t number) const {
+    if (number == 0 || number > lineTable.size())
+        return string_view();
+
+    const char *first = begin + lineTable[number - 1];
+    const char *newline = (const char *) memchr(first, '\n', (begin + length) - first);
+    return string_view(first, (newline ? newline : begin + length) - first);
+}
+
+size_t SourceBuffer::lineOffset(size_t number) const {
+    if (number == 0)
+        return 0;
+    if (number > lineTable.size())
+        return length;
+    return lineTable[number - 1];
+}
+
+void SourceBuffer::indexLines() {
+    lineTable.clear();
+    lineTable.reserve(length / 32 + 1);
+
+    // a trailing newline does not start another line
+    for (const char *it = begin, *end = begin + length; it < end;) {
+        lineTable.push_back(it - begin);
+        const char *newline = (const char *) memchr(it, '\n', end - it);
+        if (!newline)
+            break;
+        it = newline + 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+/**
+ * @file buffer.hpp
+ * @author fuechs
+ * @brief fux source buffer header
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ * 
+ */
+
+#pragma once
+
+#include "../fux.hpp"
+
+// read-only contents of a source file
+// the file is mapped into memory once and shared by the lexer,
+// the error manager and metadata through string_views
+class SourceBuffer {
+public:
+    typedef vector<uint32_t> LineTable;
+
+    // map the file at path into memory
+    // (exits if the file can not be opened, like readFile(), or is larger than 4 GiB)
+    static SourceBuffer *open(const string &path);
+    // copy contents into a buffer (e.g. repl input)
+    static SourceBuffer *fromString(const string &contents);
+    // copy of this buffer with [offset, offset + removed) replaced by inserted
+    SourceBuffer *edit(size_t offset, size_t removed, string_view inserted) const;
+
+    ~SourceBuffer();
+
+    SourceBuffer(const SourceBuffer &) = delete;
+    SourceBuffer &operator=(const SourceBuffer &) = delete;
+
+    // whole source
+    string_view view() const { return string_view(begin, length); }
+    const char *data() const { return begin; }
+    size_t size() const { return length; }
+
+    // get line from source code (line number, not index!)
+    // lines out of range are empty
+    string_view line(size_t number) const;
+    // offset of the first character of a line (line number, not index!)
+    size_t lineOffset(size_t number) const;
+    // amount of lines
+    size_t lines() const { return lineTable.size(); }
+
+private:
+    SourceBuffer() : begin(nullptr), length(0), mapped(false) {}
+
+    // fill lineTable with the offset of every line
+    void indexLines();
+
+    const char *begin;
+    size_t length;
+    bool mapped;        // begin points to a mapping instead of owned
+    string owned;
+    LineTable lineTable;
+};
\ No newline at end of file
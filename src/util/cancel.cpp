@@ -0,0 +1,14 @@
+/**
+ * @file cancel.cpp
+ * @author fuechs
+ * @brief fux cancellation token
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "cancel.hpp"
+
+CancelToken fuxCancel;
\ No newline at end of file
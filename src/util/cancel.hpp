@@ -0,0 +1,30 @@
+/**
+ * @file cancel.hpp
+ * @author fuechs
+ * @brief fux cancellation token header
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+
+// tripped by the ErrorManager once the compilation can't succeed anymore
+// (error limit reached, first error with aggressive errors);
+// the lexer, the parser, the workers and the backend poll it and stop early
+class CancelToken {
+public:
+    bool cancelled() const { return flag.load(std::memory_order_relaxed); }
+    void cancel() { flag.store(true, std::memory_order_relaxed); }
+    // before each compilation unit (file set, repl input)
+    void reset() { flag.store(false, std::memory_order_relaxed); }
+
+private:
+    std::atomic<bool> flag = false;
+};
+
+extern CancelToken fuxCancel;
\ No newline at end of file
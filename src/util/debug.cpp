@@ -14,16 +14,18 @@
 
 #include "../frontend/lexer/token.hpp"
 #include "../frontend/lexer/lexer.hpp"
+#include "../frontend/lexer/stream.hpp"
 #include "../frontend/ast/ast.hpp"
+#include "../frontend/ast/flat.hpp"
 #include "../frontend/parser/parser.hpp"
 #include "../frontend/parser/value.hpp"
 #include "../frontend/analyser/analyser.hpp"
 #include "../frontend/error/error.hpp"
+#include "threading.hpp"
 #ifdef FUX_BACKEND
 #include "../backend/context/context.hpp"
 #include "../backend/generator/generator.hpp"
 #include "../backend/compiler/compiler.hpp"
-#include "threading.hpp"
 #endif
 
 // * LEXER
@@ -34,7 +36,16 @@ void Lexer::debugPrint() {
     
     cout << debugText << "Lexer:\n";
     for (Token &token : tokens)
-        cout << token.str() << "\n";
+        cout << token.str(*buffer) << "\n";
+}
+
+void TokenStream::debugPrint(const Token &token) {
+    if (!fux.options.debugMode)
+        return;
+    
+    if (lexed == 0)
+        cout << debugText << "Lexer:\n";
+    cout << token.str(*lexer->getBuffer()) << "\n";
 }
 
 // * PARSER
@@ -87,22 +98,22 @@ void NullExprAST::debugPrint(size_t indent) { debugIndent(indent, "null"); }
 
 void BoolExprAST::debugPrint(size_t indent) { 
     debugIndent(indent);
-    value->debugPrint(); 
+    value.debugPrint(); 
 }
 
 void NumberExprAST::debugPrint(size_t indent) { 
     debugIndent(indent);
-    value->debugPrint(); 
+    value.debugPrint(); 
 }
 
 void CharExprAST::debugPrint(size_t indent) { 
     debugIndent(indent);
-    value->debugPrint(); 
+    value.debugPrint(); 
 }
 
 void StringExprAST::debugPrint(size_t indent) { 
     debugIndent(indent);
-    value->debugPrint(); 
+    value.debugPrint(literals); 
 }
 
 void RangeExprAST::debugPrint(size_t indent) {
@@ -121,7 +132,7 @@ void ArrayExprAST::debugPrint(size_t indent) {
     cout << "}";
 }
 
-void VariableExprAST::debugPrint(size_t indent) { debugIndent(indent, name); }
+void VariableExprAST::debugPrint(size_t indent) { debugIndent(indent, string(fuxSymbols[name])); }
 
 void MemberExprAST::debugPrint(size_t indent) {
     callASTDebug(indent, base);
@@ -190,7 +201,7 @@ void TernaryExprAST::debugPrint(size_t indent) {
 }
 
 void VariableDeclAST::debugPrint(size_t indent) {
-    debugIndent(indent, symbol);
+    debugIndent(indent, string(fuxSymbols[symbol]));
     type.debugPrint();
     if (value) {
         cout << " = ";
@@ -264,7 +275,7 @@ void ForLoopAST::debugPrint(size_t indent) {
 }
 
 void PrototypeAST::debugPrint(size_t indent) {
-    debugIndent(indent, symbol);
+    debugIndent(indent, string(fuxSymbols[symbol]));
     cout << "(";
     for (StmtAST::Ptr &param : args) {
         callASTDebug(0, param);
@@ -276,6 +287,7 @@ void PrototypeAST::debugPrint(size_t indent) {
 }
 
 void FunctionAST::debugPrint(size_t indent) { 
+    getBody();
     callASTDebug(indent, proto);
     cout << "\n";
     debugIndent(indent, "[ ");
@@ -308,6 +320,280 @@ void RootAST::debugPrint(size_t indent) {
     cout << endl;
 }
 
+void FlatAST::debugStmt(Index node, size_t indent, const char *null) {
+    debugIndent(indent);
+    if (!missing(node))
+        debugPrint(node, indent);
+    else
+        cout << CC::RED << null << CC::DEFAULT;
+}
+
+void FlatAST::debugExpr(Index node, size_t indent) {
+    debugIndent(indent);
+    if (!missing(node))
+        debugPrint(node, 0);
+    else
+        cout << CC::RED << "NULLEXPR" << CC::DEFAULT;
+}
+
+void FlatAST::debugBody(Index node, size_t indent) {
+    debugIndent(indent);
+    if (missing(node))
+        cout << CC::RED << "NULLBODY" << CC::DEFAULT;
+    else if (nodes[node].kind == AST::CodeBlockAST)
+        debugPrint(node, indent);
+    else
+        debugPrint(node, indent + 1);
+}
+
+void FlatAST::debugPrint() { 
+    if (!nodes.empty())
+        debugPrint(0, 0); 
+}
+
+void FlatAST::debugPrint(Index node, size_t indent) {
+    Node &that = nodes[node];
+    Index first = child(node);
+    Index last = end(node);
+
+    switch (that.kind) {
+        case AST::NoOperationAST:   debugIndent(indent, "noop"); break;
+        case AST::NullExprAST:      debugIndent(indent, "null"); break;
+
+        case AST::BoolExprAST:
+        case AST::NumberExprAST:
+        case AST::CharExprAST:
+        case AST::StringExprAST:
+            debugIndent(indent);
+            values[that.data].debugPrint(&literals);
+            break;
+        
+        case AST::RangeExprAST:
+            debugExpr(first, indent);
+            cout << "...";
+            debugExpr(next(first), 0);
+            break;
+        
+        case AST::ArrayExprAST:
+            debugIndent(indent, "{");
+            for (Index element = first; element < last; element = next(element)) {
+                debugExpr(element, 0);
+                if (next(element) < last)
+                    cout << ", ";
+            }
+            cout << "}";
+            break;
+
+        case AST::VariableExprAST:  debugIndent(indent, string(fuxSymbols[that.data])); break;
+
+        case AST::MemberExprAST:
+            debugExpr(first, indent);
+            cout << ".";
+            debugExpr(next(first), 0);
+            break;
+        
+        case AST::UnaryExprAST: {
+            UnaryOp op = (UnaryOp) that.op;
+            debugIndent(indent, "(");
+            if (op == UnaryOp::SINC || op == UnaryOp::SDEC) {
+                debugExpr(first, 0);
+                cout << UnaryOpValue(op);
+            } else {
+                cout << UnaryOpValue(op);
+                debugExpr(first, 0);
+            }
+            cout << ")";
+            break;
+        }
+
+        case AST::BinaryExprAST: {
+            BinaryOp op = (BinaryOp) that.op;
+            Index RHS = next(first);
+            debugIndent(indent, "(");
+            debugExpr(first, 0);
+            if (op == BinaryOp::IDX) {
+                if (missing(RHS)) cout << "[]";
+                else {
+                    cout << "[";
+                    debugPrint(RHS, 0);
+                    cout << "]";
+                }
+            } else {
+                cout << " " << BinaryOpValue(op) << " ";
+                debugExpr(RHS, 0);
+            }
+            cout << ")";
+            break;
+        }
+
+        case AST::CallExprAST: {
+            const bool asyncCall = that.flags & Node::ASYNC;
+            if (asyncCall)
+                debugIndent(indent, "async ");
+            debugExpr(first, asyncCall ? 0 : indent);
+            cout << "(";
+            for (Index arg = next(first); arg < last; arg = next(arg)) {
+                debugExpr(arg, 0);
+                if (next(arg) < last)
+                    cout << ", ";
+            }
+            cout << ")";
+            break;
+        }
+
+        case AST::TypeCastExprAST:
+            debugIndent(indent, "((");
+            FuxType::byId(that.type).debugPrint(true);
+            cout << ") ";
+            debugPrint(first, 0);
+            cout << ")";
+            break;
+        
+        case AST::TernaryExprAST:
+            debugIndent(indent, "(");
+            debugPrint(first, 0);
+            cout << " ? ";
+            debugPrint(next(first), 0);
+            cout << " : ";
+            debugPrint(next(next(first)), 0);
+            cout << ")";
+            break;
+
+        case AST::VariableDeclAST:
+            debugIndent(indent, string(fuxSymbols[that.data]));
+            FuxType::byId(that.type).debugPrint();
+            if (!missing(first)) {
+                cout << " = ";
+                debugPrint(first, 0);
+            }
+            break;
+
+        case AST::InbuiltCallAST: {
+            Inbuilts callee = (Inbuilts) that.op;
+            debugIndent(indent, InbuiltsValue(callee));
+            cout << " ";
+            for (Index arg = first; arg < last; arg = next(arg)) {
+                debugExpr(arg, 0);
+                if (next(arg) < last)
+                    cout << ", ";
+            }
+            break;
+        }
+
+        case AST::IfElseAST: {
+            Index thenBody = next(first);
+            Index elseBody = next(thenBody);
+            debugIndent(indent, "if (");
+            debugExpr(first, 0);
+            cout << ")\n";
+            debugBody(thenBody, indent);
+            if (missing(elseBody))
+                break;
+            cout << ";\n";
+            debugIndent(indent, "else\n");
+            debugBody(elseBody, indent);
+            break;
+        }
+
+        case AST::CodeBlockAST:
+            debugIndent(indent, "{\n");
+            for (Index stmt = first; stmt < last; stmt = next(stmt)) {
+                debugStmt(stmt, indent + 1);
+                cout << ";\n";
+            }
+            debugIndent(indent*2, "}");
+            break;
+
+        case AST::WhileLoopAST:
+            if (that.flags & Node::POST) {
+                debugIndent(indent, "do\n");
+                debugBody(next(first), indent);
+                cout << "\n";
+                debugIndent(indent, "while (");
+                debugExpr(first, 0);
+                cout << ")";
+                break;
+            }
+
+            debugIndent(indent, "while (");
+            debugExpr(first, 0);
+            cout << ")\n";
+            debugBody(next(first), indent);
+            break;
+
+        case AST::ForLoopAST: {
+            Index condition = next(first);
+            Index iterator = next(condition);
+            debugIndent(indent, "for (");
+            debugStmt(first, 0);
+            if (that.flags & Node::EACH) {
+                cout << " in ";
+                debugExpr(iterator, 0);
+            } else {
+                cout << "; ";
+                debugExpr(condition, 0);
+                cout << "; ";
+                debugExpr(iterator, 0);
+            }
+            cout << ")\n";
+            debugBody(next(iterator), indent);
+            break;
+        }
+
+        case AST::PrototypeAST:
+            debugIndent(indent, string(fuxSymbols[that.data]));
+            cout << "(";
+            for (Index param = first; param < last; param = next(param)) {
+                debugStmt(param, 0);
+                if (next(param) < last)
+                    cout << ", ";
+            }
+            cout << ")";
+            FuxType::byId(that.type).debugPrint();
+            break;
+
+        case AST::FunctionAST: {
+            // the body is the last child, locals are in between
+            Index body = next(first);
+            while (next(body) < last)
+                body = next(body);
+            debugStmt(first, indent, "NULLPROTO");
+            cout << "\n";
+            debugIndent(indent, "[ ");
+            for (Index local = next(first); local < body; local = next(local)) {
+                debugStmt(local, 0);
+                if (next(local) < body)
+                    cout << "; ";
+            }
+            cout << " ]\n";
+            debugBody(body, indent);
+            break;
+        }
+
+        case AST::RootAST: {
+            if (!fux.options.debugMode)
+                return;
+
+            cout << debugText << "Root AST";
+
+            Index stmt = first;
+            for (size_t i = 0; i < that.data; i++, stmt = next(stmt)) {
+                cout << "\n";
+                cout << "[" << CC::YELLOW << SC::UNDERLINE << i << CC::DEFAULT << SC::RESET << "]: ";
+                debugExpr(stmt, indent);
+            }
+
+            for (; stmt < last; stmt = next(stmt)) {
+                cout << "\n";
+                debugStmt(stmt, 0);
+                cout << ";";
+            }
+            cout << endl;
+            break;
+        }
+    }
+}
+
 void Parser::debugPrint(const string message) {
     if (!fux.options.debugMode)
         return;
@@ -318,12 +604,12 @@ void Parser::debugPrint(const string message) {
     cout << "\n";
 }
 
-void ValueStruct::debugPrint() {
-    switch (type.kind) {
+void ValueStruct::debugPrint(const LiteralPool *literals) {
+    switch (type->kind) {
         case FuxType::BOOL:     cout << (__bool ? "true" : "false"); break;
         case FuxType::I8:       cout << __i8; break;
         case FuxType::U8:       cout << to_string(__u8); break;
-        case FuxType::C8:       cout << "'" << unescapeSequences(&__c8) << "'"; break;
+        case FuxType::C8:       cout << "'" << unescapeSequences(string(1, __c8)) << "'"; break;
         case FuxType::I16:      cout << __i16; break;
         case FuxType::U16:      cout << __u16; break;
         case FuxType::C16:      cout << "'" << to_string(__c16) << "'"; break;
@@ -333,7 +619,7 @@ void ValueStruct::debugPrint() {
         case FuxType::I64:      cout << __i64; break;
         case FuxType::U64:      cout << __u64; break;
         case FuxType::F64:      cout << __f64; break;
-        case FuxType::LIT:      cout << '"' << unescapeSequences(__lit) << '"'; break;
+        case FuxType::LIT:      cout << '"' << unescapeSequences(string((*literals)[__lit])) << '"'; break;
         default:                cout << "???";
     }
 }
@@ -350,6 +636,18 @@ void Analyser::debugPrint(const string message) {
     cout << "\n";
 }
 
+// * THREADING
+
+void fuxThread::ThreadPool::debugPrint(const string message) {
+    if (!fux.options.debugMode)
+        return;
+        
+    cout << debugText << "ThreadPool (" << list.size() << " workers)";
+    if (!message.empty())
+        cout << ": " << message;
+    cout << "\n";
+}
+
 #ifdef FUX_BACKEND
 
 // * CONTEXT
@@ -388,26 +686,4 @@ void Compiler::debugPrint(const string message) {
     cout << "\n";
 }
 
-// * THREADING
-
-void fuxThread::Thread::debugPrint(const string message) {  
-    if (!fux.options.debugMode)
-        return;
-            
-    cout << debugText << "Thread '" << name << "' (" << id << ")";
-    if (!message.empty())
-        cout << ": " << message;
-    cout << "\n";
-}
-
-void fuxThread::ThreadManager::debugPrint(const string message) {
-    if (!fux.options.debugMode)
-        return;
-        
-    cout << debugText << "ThreadManager";
-    if (!message.empty())
-        cout << ": " << message;
-    cout << "\n";
-}
-
 #endif
\ No newline at end of file
@@ -0,0 +1,128 @@
+/**
+ * @file literals.cpp
+ * @author fuechs
+ * @brief fux literal pool
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "literals.hpp"
+
+LiteralPool::LiteralPool() : used(0) {
+    for (std::atomic<char *> &chunk : chunks)
+        chunk.store(nullptr, std::memory_order_relaxed);
+}
+
+LiteralPool::~LiteralPool() { clear(); }
+
+LiteralPool::LiteralPool(const LiteralPool &copy) : LiteralPool() { *this = copy; }
+
+LiteralPool::LiteralPool(LiteralPool &&other) : LiteralPool() { *this = std::move(other); }
+
+LiteralPool &LiteralPool::operator=(const LiteralPool &copy) {
+    if (this == &copy)
+        return *this;
+    clear();
+    for (size_t c = 0; c < maxChunks; c++)
+        if (const char *chunk = copy.chunks[c].load(std::memory_order_acquire)) {
+            char *own = new char[chunkSize(c)];
+            memcpy(own, chunk, chunkSize(c));
+            chunks[c].store(own, std::memory_order_release);
+        }
+    used.store(copy.size(), std::memory_order_release);
+    return *this;
+}
+
+LiteralPool &LiteralPool::operator=(LiteralPool &&other) {
+    if (this == &other)
+        return *this;
+    clear();
+    for (size_t c = 0; c < maxChunks; c++)
+        chunks[c].store(other.chunks[c].exchange(nullptr), std::memory_order_release);
+    used.store(other.used.exchange(0), std::memory_order_release);
+    return *this;
+}
+
+LiteralPool::Literal LiteralPool::add(string_view text) {
+    if (text.empty())
+        return {0, 0};
+
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t offset = used.load(std::memory_order_relaxed);
+    size_t chunk = chunkOf(offset);
+    while (offset + text.size() > chunkBegin(chunk + 1)) // doesn't fit, the next chunk is twice as large
+        offset = chunkBegin(++chunk);
+    assert(chunk < maxChunks && offset + text.size() <= UINT32_MAX && "too many literals");
+
+    char *storage = chunks[chunk].load(std::memory_order_relaxed);
+    if (!storage) {
+        storage = new char[chunkSize(chunk)]();
+        chunks[chunk].store(storage, std::memory_order_release);
+    }
+    memcpy(storage + offset - chunkBegin(chunk), text.data(), text.size());
+    used.store(offset + text.size(), std::memory_order_release);
+    return {(uint32_t) offset, (uint32_t) text.size()};
+}
+
+string_view LiteralPool::operator[](Literal literal) const {
+    if (literal.length == 0)
+        return string_view();
+    assert(contains(literal) && "unknown literal");
+    const size_t chunk = chunkOf(literal.offset);
+    return string_view(chunks[chunk].load(std::memory_order_acquire) + literal.offset - chunkBegin(chunk), literal.length);
+}
+
+bool LiteralPool::contains(Literal literal) const {
+    const size_t end = (size_t) literal.offset + literal.length;
+    return literal.length == 0
+        || (end <= size() && chunkOf(literal.offset) == chunkOf(end - 1));
+}
+
+size_t LiteralPool::size() const { return used.load(std::memory_order_acquire); }
+
+size_t LiteralPool::bytes() const {
+    size_t allocated = 0;
+    for (size_t c = 0; c < maxChunks; c++)
+        if (chunks[c].load(std::memory_order_acquire))
+            allocated += chunkSize(c);
+    return allocated;
+}
+
+string LiteralPool::image() const {
+    const size_t length = size();
+    string result = string(length, '\0');
+    for (size_t c = 0; chunkBegin(c) < length; c++)
+        if (const char *chunk = chunks[c].load(std::memory_order_acquire))
+            memcpy(result.data() + chunkBegin(c), chunk, std::min(chunkSize(c), length - chunkBegin(c)));
+    return result;
+}
+
+void LiteralPool::assign(string_view image) {
+    assert(image.size() <= UINT32_MAX && "too many literals");
+    clear();
+    for (size_t c = 0; chunkBegin(c) < image.size(); c++) {
+        char *chunk = new char[chunkSize(c)]();
+        memcpy(chunk, image.data() + chunkBegin(c), std::min(chunkSize(c), image.size() - chunkBegin(c)));
+        chunks[c].store(chunk, std::memory_order_release);
+    }
+    used.store(image.size(), std::memory_order_release);
+}
+
+size_t LiteralPool::chunkOf(size_t offset) {
+    return 63 - __builtin_clzll(offset + ((size_t) 1 << firstBits)) - firstBits;
+}
+
+size_t LiteralPool::chunkBegin(size_t chunk) {
+    return ((size_t) 1 << (chunk + firstBits)) - ((size_t) 1 << firstBits);
+}
+
+size_t LiteralPool::chunkSize(size_t chunk) { return (size_t) 1 << (chunk + firstBits); }
+
+void LiteralPool::clear() {
+    for (std::atomic<char *> &chunk : chunks)
+        delete [] chunk.exchange(nullptr);
+    used.store(0, std::memory_order_release);
+}
\ No newline at end of file
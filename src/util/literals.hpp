@@ -0,0 +1,70 @@
+/**
+ * @file literals.hpp
+ * @author fuechs
+ * @brief fux literal pool header
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "../fux.hpp"
+
+// contents of the string literals of a file (with escape sequences resolved),
+// so a literal is only an offset and a length (see ValueStruct).
+// the pool only grows and never moves, reading is lock-free
+class LiteralPool {
+public:
+    struct Literal {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    LiteralPool();
+    ~LiteralPool();
+
+    // literals keep their offsets
+    LiteralPool(const LiteralPool &copy);
+    LiteralPool(LiteralPool &&other);
+    LiteralPool &operator=(const LiteralPool &copy);
+    LiteralPool &operator=(LiteralPool &&other);
+
+    // copy text into the pool
+    Literal add(string_view text);
+    // get text of literal
+    string_view operator[](Literal literal) const;
+    // whether literal lies within the pool
+    bool contains(Literal literal) const;
+
+    // bytes from offset 0 to the end of the last literal
+    size_t size() const;
+    // allocated bytes
+    size_t bytes() const;
+
+    // all literals at their offsets (unused space is 0), see assign()
+    string image() const;
+    // replace the literals with an image
+    void assign(string_view image);
+
+private:
+    // chunk c holds offsets [2^(c+firstBits) - 2^firstBits, 2^(c+firstBits+1) - 2^firstBits),
+    // a literal is never split between chunks
+    static constexpr size_t firstBits = 10;
+    static constexpr size_t maxChunks = 32 - firstBits + 1;
+
+    static size_t chunkOf(size_t offset);
+    static size_t chunkBegin(size_t chunk);
+    static size_t chunkSize(size_t chunk);
+
+    void clear();
+
+    std::atomic<char *> chunks[maxChunks];
+    std::atomic<size_t> used;
+    std::mutex mutex;
+};
\ No newline at end of file
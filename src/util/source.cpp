@@ -10,6 +10,8 @@
  */
 
 #include "source.hpp"
+#include "../frontend/ast/cache.hpp"
+#include "threading.hpp"
 
 #include <filesystem>
 
@@ -18,27 +20,62 @@ SourceFile::SourceFile(ErrorManager *error, const string &filePath, const bool m
     this->filePath = filePath;
     this->fileName = getFileName(filePath);
     this->fileDir = getDirectory(filePath);
-    this->contents = readFile(filePath);
+    this->buffer = SourceBuffer::open(filePath);
     this->mainFile = mainFile;
+    this->parser = nullptr;
+    this->analyser = nullptr;
 }
 
 SourceFile::~SourceFile() {
     filePath.clear();
     fileName.clear();
     fileDir.clear();
-    contents.clear();
     delete parser;
     delete analyser;
     delete error;
+    delete buffer;
 }
 
 void SourceFile::parse() {
-    parser = new Parser(error, filePath, contents, mainFile);
+    Arena::Scope scope(&arena);
+    FlatAST flat;
+    if (!mainFile && ASTCache::read(ASTCache::path(filePath), *buffer, flat)) {
+        root = flat.tree();
+        return;
+    }
+
+    // bodies of packages are only parsed when they are needed (at the latest in cache())
+    parser = new Parser(error, filePath, buffer, mainFile, !mainFile);
     root = parser->parse();
+    error->report();
     // analyser = new Analyser(error, root);
     // analysed = analyser->analyse();
 }
 
+void SourceFile::cache() {
+    if (mainFile || !parser || errors()) // main file or loaded from the cache
+        return;
+
+    Arena::Scope scope(&arena);
+    const FlatAST flat = FlatAST(*root); // parses the remaining bodies
+    error->report();
+    if (!errors())
+        ASTCache::write(ASTCache::path(filePath), flat, *buffer, fileName);
+}
+
+void SourceFile::parse(const Vec &files) {
+    if (files.size() == 1) // nothing to parse in parallel
+        return files.front()->parse();
+
+    fuxThread::TaskGroup group;
+    for (SourceFile *file : files)
+        group.run([file] {
+            if (!fuxCancel.cancelled())
+                file->parse();
+        });
+    group.wait();
+}
+
 size_t SourceFile::errors() { return error->errors(); }
 
 size_t SourceFile::getFileSize() {
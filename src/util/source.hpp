@@ -15,22 +15,27 @@
 #include "../frontend/error/error.hpp"
 #include "../frontend/parser/parser.hpp"
 #include "../frontend/analyser/analyser.hpp"
+#include "../frontend/ast/flat.hpp"
+#include "arena.hpp"
+#include "buffer.hpp"
 
 class SourceFile {
 public:
     typedef vector<SourceFile *> Vec;
-    typedef vector<Vec> Groups;
 
     SourceFile(ErrorManager *error, const string &filePath, const bool mainFile = false);
     
     ~SourceFile();
 
-    // get std::thread to run this->parse
-    void operator()() { this->parse(); }
-    
     // parse file and save RootAST in root
     // will be called for every file that's referenced 
+    // (packages are built from their cache if it is up to date)
     void parse();
+    // parse files on the thread pool, returns once all of them are parsed
+    static void parse(const Vec &files);
+    // packages: parse the bodies that weren't needed, report their errors
+    // and write the cache if there are none
+    void cache();
 
     // check if file has errors
     size_t errors();
@@ -43,6 +48,7 @@ public:
     string filePath;
     string fileDir;
 
+    Arena arena; // holds the nodes of root, so it has to outlive them
     RootAST::Ptr root;
     StmtAST::Ptr analysed;
     
@@ -50,6 +56,6 @@ private:
     ErrorManager *error;
     Parser *parser;
     Analyser *analyser;
-    string contents;
+    SourceBuffer *buffer;
     bool mainFile;
 };
\ No newline at end of file
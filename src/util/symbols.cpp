@@ -0,0 +1,138 @@
+/**
+ * @file symbols.cpp
+ * @author fuechs
+ * @brief fux symbol pool
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#include "symbols.hpp"
+
+SymbolPool fuxSymbols;
+
+SymbolPool::Table::Table(size_t capacity) : mask(capacity - 1), slots(new std::atomic<SymbolId>[capacity]) {
+    for (size_t i = 0; i < capacity; i++)
+        slots[i].store(none, std::memory_order_relaxed);
+}
+
+SymbolPool::Table::~Table() { delete [] slots; }
+
+SymbolPool::SymbolPool() : table(new Table(1024)), count(1), block(nullptr), blockUsed(blockSize) {
+    for (std::atomic<Entry *> &chunk : chunks)
+        chunk.store(nullptr, std::memory_order_relaxed);
+    Entry *first = new Entry[1 << firstBits];
+    first[none] = {"", 0, hash("")};
+    chunks[0].store(first, std::memory_order_release);
+}
+
+SymbolPool::~SymbolPool() {
+    for (std::atomic<Entry *> &chunk : chunks)
+        delete [] chunk.load();
+    delete table.load();
+    for (Table *old : retired)
+        delete old;
+    for (char *block : blocks)
+        delete [] block;
+}
+
+SymbolId SymbolPool::intern(string_view name) {
+    if (name.empty())
+        return none;
+
+    const uint32_t nameHash = hash(name);
+    if (SymbolId id = find(name, nameHash))
+        return id;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (SymbolId id = find(name, nameHash)) // added by another thread
+        return id;
+    return insert(name, nameHash);
+}
+
+string_view SymbolPool::operator[](SymbolId id) const {
+    const Entry &that = entry(id);
+    return string_view(that.text, that.length);
+}
+
+size_t SymbolPool::size() const { return count.load(std::memory_order_acquire); }
+
+uint32_t SymbolPool::hash(string_view name) {
+    uint32_t value = 2166136261u; // fnv-1a
+    for (const char &c : name)
+        value = (value ^ (uint8_t) c) * 16777619u;
+    return value;
+}
+
+const SymbolPool::Entry &SymbolPool::entry(SymbolId id) const {
+    assert(id < size() && "unknown symbol id");
+    const size_t index = (size_t) id + (1 << firstBits);
+    const size_t bit = 63 - __builtin_clzll(index);
+    return chunks[bit - firstBits].load(std::memory_order_acquire)[index - ((size_t) 1 << bit)];
+}
+
+SymbolId SymbolPool::find(string_view name, uint32_t nameHash) const {
+    const Table *current = table.load(std::memory_order_acquire);
+    for (size_t i = nameHash & current->mask;; i = (i + 1) & current->mask) {
+        const SymbolId id = current->slots[i].load(std::memory_order_acquire);
+        if (id == none)
+            return none;
+        const Entry &that = entry(id);
+        if (that.hash == nameHash && string_view(that.text, that.length) == name)
+            return id;
+    }
+}
+
+SymbolId SymbolPool::insert(string_view name, uint32_t nameHash) {
+    const SymbolId id = count.load(std::memory_order_relaxed);
+    assert(id != UINT32_MAX && "too many symbols");
+
+    const size_t index = (size_t) id + (1 << firstBits);
+    const size_t bit = 63 - __builtin_clzll(index);
+    Entry *chunk = chunks[bit - firstBits].load(std::memory_order_relaxed);
+    if (!chunk) {
+        chunk = new Entry[(size_t) 1 << bit];
+        chunks[bit - firstBits].store(chunk, std::memory_order_release);
+    }
+    chunk[index - ((size_t) 1 << bit)] = {store(name), (uint32_t) name.length(), nameHash};
+    count.store(id + 1, std::memory_order_release);
+
+    Table *current = table.load(std::memory_order_relaxed);
+    if ((id + 1) * 2 > current->mask + 1) { // keep the load factor below 1/2
+        Table *larger = new Table((current->mask + 1) * 2);
+        for (SymbolId old = 1; old < id; old++)
+            for (size_t i = entry(old).hash & larger->mask;; i = (i + 1) & larger->mask)
+                if (larger->slots[i].load(std::memory_order_relaxed) == none) {
+                    larger->slots[i].store(old, std::memory_order_relaxed);
+                    break;
+                }
+        table.store(larger, std::memory_order_release);
+        retired.push_back(current);
+        current = larger;
+    }
+
+    size_t i = nameHash & current->mask;
+    while (current->slots[i].load(std::memory_order_relaxed) != none)
+        i = (i + 1) & current->mask;
+    current->slots[i].store(id, std::memory_order_release);
+    return id;
+}
+
+const char *SymbolPool::store(string_view name) {
+    if (name.length() > blockSize / 4) { // own block for long names
+        blocks.push_back(new char[name.length()]);
+        memcpy(blocks.back(), name.data(), name.length());
+        return blocks.back();
+    }
+
+    if (blockUsed + name.length() > blockSize) {
+        blocks.push_back((block = new char[blockSize]));
+        blockUsed = 0;
+    }
+    char *text = block + blockUsed;
+    memcpy(text, name.data(), name.length());
+    blockUsed += name.length();
+    return text;
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+/**
+ * @file symbols.hpp
+ * @author fuechs
+ * @brief fux symbol pool header
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2020-2026, Fuechs and Contributors. All rights reserved.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "../fux.hpp"
+
+typedef uint32_t SymbolId;
+
+// every name (identifier) is stored once and referred to by its id,
+// so names compare and hash as integers; the lexer interns all identifiers.
+// looking up names and ids is lock-free, only adding a new name takes a lock
+class SymbolPool {
+public:
+    static constexpr SymbolId none = 0; // id of the empty name
+
+    SymbolPool();
+    ~SymbolPool();
+
+    SymbolPool(const SymbolPool &) = delete;
+    SymbolPool &operator=(const SymbolPool &) = delete;
+
+    // get id of name, adding it if it is new
+    SymbolId intern(string_view name);
+    // get name of id
+    string_view operator[](SymbolId id) const;
+    // amount of names (including the empty name)
+    size_t size() const;
+
+private:
+    struct Entry {
+        const char *text;
+        uint32_t length;
+        uint32_t hash;
+    };
+
+    // open addressing; slots hold ids (none: empty)
+    struct Table {
+        Table(size_t capacity);
+        ~Table();
+
+        size_t mask;
+        std::atomic<SymbolId> *slots;
+    };
+
+    // chunk c holds ids [2^(c+firstBits) - 2^firstBits, 2^(c+firstBits+1) - 2^firstBits),
+    // so chunks never move and all ids fit into maxChunks chunks
+    static constexpr size_t firstBits = 8;
+    static constexpr size_t maxChunks = 32 - firstBits + 1;
+    static constexpr size_t blockSize = 64 * 1024;
+
+    static uint32_t hash(string_view name);
+
+    const Entry &entry(SymbolId id) const;
+    SymbolId find(string_view name, uint32_t hash) const;
+    // add name (needs the lock)
+    SymbolId insert(string_view name, uint32_t hash);
+    // copy name into a block (needs the lock)
+    const char *store(string_view name);
+
+    std::atomic<Entry *> chunks[maxChunks];
+    std::atomic<Table *> table;
+    std::atomic<size_t> count;
+
+    std::mutex mutex;
+    vector<Table *> retired;    // old tables, may still be read until destruction
+    vector<char *> blocks;      // storage for the names
+    char *block;                // block that is filled
+    size_t blockUsed;
+};
+
+extern SymbolPool fuxSymbols;
\ No newline at end of file
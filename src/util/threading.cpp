@@ -11,107 +11,139 @@
 
 #include "threading.hpp"
 
-#ifdef FUX_BACKEND
-
 namespace fuxThread {
 
-    Thread::Thread(const string &name, size_t id) 
-    : name(name), id(id), it(std::future<void>()) {
-        debugPrint("Initialized this thread.");
-    }
-
-    Thread::~Thread() { 
-        name.clear(); 
-        delete &it;
-        debugPrint("Deleted this thread.");
-    }
-
-    void Thread::run(SourceFile *sf) { 
-        debugPrint("Creating thread.");
-        it = async(std::launch::async, std::ref(*sf));
-        debugPrint("Running thread.");
-    }
-
-    void Thread::finish() {
-        it.get(); 
-        debugPrint("Finished thread.");
-    }
+    static thread_local const ThreadPool *currentPool = nullptr;
+    static thread_local size_t currentWorker = 0;
 
-    void Thread::setName(const string &name) {
-        this->name = name;
+    ThreadPool::ThreadPool(size_t workers) : next(0), queued(0), stopping(false) {
+        for (size_t i = 0; i < workers; i++)
+            list.push_back(new Worker());
+        for (size_t i = 0; i < workers; i++)
+            list[i]->thread = std::thread(&ThreadPool::work, this, i);
+        debugPrint("Started.");
     }
 
-    ThreadManager::ThreadManager() : threads(ThreadList()), required({{}}) {
-        threadsMax = std::thread::hardware_concurrency() - 2;
-        debugPrint("Max amount of threads: "+to_string(threadsMax+2)+" -> "+to_string(threadsMax));
-        if (fux.options.debugMode)
-            debugPrint("Limited to one (1) thread because of compiler flags.");
-        if (!fux.options.threading)
-            debugPrint("Threading is set to false.");
-    }
-
-    ThreadManager::~ThreadManager() {
-        for (Thread *thread : threads)
-            delete thread;
-        threads.clear();
-    }
-
-    void ThreadManager::require(SourceFile *sf) { 
-        if (required.back().size() < threadsMax) {
-            required.back().push_back(sf);
-            return;
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
         }
-
-        required.push_back({sf});
+        wake.notify_all();
+        for (Worker *worker : list) {
+            worker->thread.join();
+            delete worker;
+        }
+        list.clear();
     }
 
-    void ThreadManager::createThreads() {
-        if (!fux.options.threading)
-            return;
-
-        if (fux.options.debugMode) {
-            threads.push_back(new Thread("universal debug thread", threads.size()));
+    void ThreadPool::submit(Task task, Priority priority) {
+        if (list.empty()) {
+            task();
             return;
         }
 
-        while (threads.size() > required[0].size()) { // delete unused threads
-            delete threads.back();
-            threads.pop_back();
+        size_t index = self();
+        if (index == list.size())
+            index = next.fetch_add(1, std::memory_order_relaxed) % list.size();
+        {
+            std::lock_guard<std::mutex> lock(list[index]->mutex);
+            list[index]->tasks[priority].push_back(std::move(task));
         }
-
-        while (threads.size() < required[0].size()) // create required threads
-            threads.push_back(new Thread(required[0][threads.size()]->fileName, threads.size()));
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            ++queued;
+        }
+        wake.notify_one();
     }
 
-    void ThreadManager::runThreads() {
-        if (!fux.options.threading) {
-            for (SourceFile::Vec &fl : required)
-                for (SourceFile *sf : fl)
-                    sf->parse();
-            return;
-        }
+    bool ThreadPool::runOne() {
+        Task task;
+        if (!take(self(), task))
+            return false;
+        task();
+        return true;
+    }
 
-        if (fux.options.debugMode) {
-            for (SourceFile::Vec &fl : required)
-                for (SourceFile *sf : fl) {
-                    threads[0]->run(sf);
-                    threads[0]->finish();
+    size_t ThreadPool::workers() const { return list.size(); }
+
+    size_t ThreadPool::self() const { return currentPool == this ? currentWorker : list.size(); }
+
+    bool ThreadPool::take(size_t self, Task &task) {
+        if (queued.load() <= 0)
+            return false;
+
+        for (size_t priority = 0; priority < PRIORITIES; priority++)
+            for (size_t i = 0; i < list.size(); i++) {
+                const size_t index = (self + i) % list.size();
+                std::deque<Task> &tasks = list[index]->tasks[priority];
+                std::lock_guard<std::mutex> lock(list[index]->mutex);
+                if (tasks.empty())
+                    continue;
+                if (index == self) {
+                    task = std::move(tasks.back());
+                    tasks.pop_back();
+                } else {
+                    task = std::move(tasks.front());
+                    tasks.pop_front();
                 }
-            return;
-        }
+                --queued;
+                return true;
+            }
+        return false;
+    }
 
-        for (SourceFile::Vec &fl : required) {
-            for (size_t i = 0; i < fl.size(); i++)
-                threads[i]->run(fl[i]);
-            checkThreads();
+    void ThreadPool::work(size_t self) {
+        currentPool = this;
+        currentWorker = self;
+        for (Task task;;) {
+            if (take(self, task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wake.wait(lock, [&] { return stopping || queued.load() > 0; });
+            if (stopping && queued.load() <= 0)
+                return;
         }
     }
 
-    void ThreadManager::checkThreads() {
-        for (Thread *thread : threads)
-            thread->finish();
+    ThreadPool &pool() {
+        static ThreadPool instance(!fux.options.threading ? 0 
+            : fux.options.jobs ? fux.options.jobs 
+            : std::max(1u, std::thread::hardware_concurrency()));
+        return instance;
     }
 
-}
+    TaskGroup::TaskGroup(ThreadPool &owner) : owner(owner), pending(0) {}
+
+    TaskGroup::~TaskGroup() { wait(); }
+
+    void TaskGroup::run(ThreadPool::Task task, ThreadPool::Priority priority) {
+        ++pending;
+        ThreadPool *pool = &owner;
+        owner.submit([this, pool, task = std::move(task)] {
+            task();
+            bool done;
+            {
+                // the group may be gone as soon as pending is 0
+                std::lock_guard<std::mutex> lock(pool->sleepMutex);
+                done = --pending == 0;
+            }
+            if (done)
+                pool->wake.notify_all();
+        }, priority);
+    }
+
+    void TaskGroup::wait() {
+        while (pending.load() > 0) {
+            if (owner.runOne())
+                continue;
+            std::unique_lock<std::mutex> lock(owner.sleepMutex);
+            owner.wake.wait(lock, [&] { return pending.load() == 0 || owner.queued.load() > 0; });
+        }
+    }
 
-#endif
\ No newline at end of file
+}
\ No newline at end of file
@@ -11,59 +11,91 @@
 
 #pragma once
 
-#include "source.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <thread>
 
-#ifdef FUX_BACKEND
+#include "../fux.hpp"
 
 namespace fuxThread {
 
-    class Thread {
+    // persistent workers with a deque of tasks per priority each;
+    // a worker runs its newest task first and steals the oldest task of another one when it runs dry.
+    // tasks that are submitted by a task go to the deque of its worker
+    class ThreadPool {
     public:
-        Thread(const string &name = "unnamed", size_t id = 0);
-        ~Thread();
+        enum Priority {
+            HIGH,       // someone waits for it (nested tasks)
+            NORMAL,
+            LOW,
+            PRIORITIES,
+        };
 
-        void debugPrint(const string message);
-        // create thread and run sf->parse    
-        void run(SourceFile *sf);
+        typedef std::function<void()> Task;
+
+        // without workers, tasks run as soon as they are submitted
+        ThreadPool(size_t workers);
+        // runs the remaining tasks
+        ~ThreadPool();
 
-        // wait until thread is finished
-        void finish();
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
 
-        void setName(const string &name); 
+        void submit(Task task, Priority priority = NORMAL);
+        // run one queued task on the current thread
+        // returns false if there was none
+        bool runOne();
+
+        size_t workers() const;
+
+        void debugPrint(const string message);
 
     private:
-        size_t id;
-        string name;
-        std::future<void> it;
+        struct Worker {
+            std::mutex mutex;
+            std::deque<Task> tasks[PRIORITIES];
+            std::thread thread;
+        };
+
+        vector<Worker *> list;
+        std::atomic<size_t> next;       // for tasks from outside of the pool
+        std::atomic<ptrdiff_t> queued;
+        bool stopping;
+        std::mutex sleepMutex;          // guards stopping, sleeping on wake
+        std::condition_variable wake;
+
+        // index of the worker of the current thread, or workers() if it belongs to none
+        size_t self() const;
+        // take the task with the highest priority, preferring the deque of worker self
+        bool take(size_t self, Task &task);
+        void work(size_t self);
+
+        friend class TaskGroup;
     };
 
-    typedef vector<Thread *> ThreadList;
+    // the pool of the compiler, created on first use with
+    // -j workers (default: one per core), or none with -nothread
+    ThreadPool &pool();
 
-    class ThreadManager {
+    // tasks that are waited for together;
+    // the waiting thread runs queued tasks in the meantime, so groups can be nested
+    class TaskGroup {
     public:
-        ThreadManager();
-        ~ThreadManager();
-        
-        // adds a requirement to parse the SourceFile
-        void require(SourceFile *sf);
-        // prints information about all managed threads
-        void debugPrint(const string message);
-        // create threads that are required
-        // delete threads that are unused
-        void createThreads(); 
-        // parse all required SourceFiles with the threads
-        void runThreads();
-       
-        
+        TaskGroup(ThreadPool &owner = pool());
+        // waits
+        ~TaskGroup();
+
+        TaskGroup(const TaskGroup &) = delete;
+        TaskGroup &operator=(const TaskGroup &) = delete;
+
+        void run(ThreadPool::Task task, ThreadPool::Priority priority = ThreadPool::NORMAL);
+        // wait until every task of the group is finished
+        void wait();
+
     private:
-        ThreadList threads;
-        SourceFile::Groups required;
-        size_t threadsMax;
-        
-        // wait until all threads are finished
-        void checkThreads(); 
+        ThreadPool &owner;
+        std::atomic<size_t> pending;
     };
 
-}
-
-#endif
\ No newline at end of file
+}
\ No newline at end of file